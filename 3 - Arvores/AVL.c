@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "snapshot.h"  // Formato binário para salvar e carregar a árvore
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
 // Definição da estrutura do nó da árvore AVL
 // São utilizados três parâmetros: dado, esquerda e direita, além da altura para balanceamento
@@ -101,7 +105,7 @@ struct NoAVL *rotacaoEsquerda(struct NoAVL *no)
 
 // Função que vai realizar o balanceamento da árvore
 // Utiliza as funções anteriores para analisar cada caso
-struct NoAVL *balanceamento(struct NoAVL *raiz, int dado)
+struct NoAVL *balanceamento(struct NoAVL *raiz)
 {
     // Atualiza a altura do nó atual
     if (raiz == NULL) // Se a raiz for nula, retorna a raiz
@@ -120,23 +124,26 @@ struct NoAVL *balanceamento(struct NoAVL *raiz, int dado)
     // Calcula o fator de balanceamento deste nó para verificar se ele se tornou desbalanceado
     int balanceamento = fatorBalanceamento(raiz); // Calcula o fator de balanceamento da raiz
 
+    // Os casos são decididos pelo fator de balanceamento do filho (e não pelo dado),
+    // o que vale tanto para a inserção quanto para a exclusão
+
     // Caso de desbalanceamento à esquerda-esquerda
-    if (balanceamento > 1 && dado < raiz->esquerda->dado) // Se o fator de balanceamento for maior que 1 e o dado for menor que o dado da subárvore esquerda
-        return rotacaoDireita(raiz);                      // Realiza rotação à direita
+    if (balanceamento > 1 && fatorBalanceamento(raiz->esquerda) >= 0) // Se o fator de balanceamento for maior que 1 e a subárvore esquerda não pende para a direita
+        return rotacaoDireita(raiz);                                    // Realiza rotação à direita
 
     // Caso de desbalanceamento à direita-direita
-    if (balanceamento < -1 && dado > raiz->direita->dado) // Se o fator de balanceamento for menor que -1 e o dado for maior que o dado da subárvore direita
-        return rotacaoEsquerda(raiz);                     // Realiza rotação à esquerda
+    if (balanceamento < -1 && fatorBalanceamento(raiz->direita) <= 0) // Se o fator de balanceamento for menor que -1 e a subárvore direita não pende para a esquerda
+        return rotacaoEsquerda(raiz);                                   // Realiza rotação à esquerda
 
     // Caso de desbalanceamento à esquerda-direita
-    if (balanceamento > 1 && dado > raiz->esquerda->dado) // Se o fator de balanceamento for maior que 1 e o dado for maior que o dado da subárvore esquerda
+    if (balanceamento > 1 && fatorBalanceamento(raiz->esquerda) < 0) // Se o fator de balanceamento for maior que 1 e a subárvore esquerda pende para a direita
     {
         raiz->esquerda = rotacaoEsquerda(raiz->esquerda); // Realiza rotação à esquerda na subárvore esquerda da raiz
         return rotacaoDireita(raiz);                      // Realiza rotação à direita na raiz
     }
 
     // Caso de desbalanceamento à direita-esquerda
-    if (balanceamento < -1 && dado < raiz->direita->dado) // Se o fator de balanceamento for menor que -1 e o dado for menor que o dado da subárvore direita
+    if (balanceamento < -1 && fatorBalanceamento(raiz->direita) > 0) // Se o fator de balanceamento for menor que -1 e a subárvore direita pende para a esquerda
     {
         raiz->direita = rotacaoDireita(raiz->direita); // Realiza rotação à direita na subárvore direita da raiz
         return rotacaoEsquerda(raiz);                  // Realiza rotação à esquerda na raiz
@@ -173,7 +180,7 @@ struct NoAVL *inserir(struct NoAVL *raiz, int dado)
     }
 
     // Após a inserção, chama a função de balanceamento para garantir que a árvore permaneça balanceada
-    return balanceamento(raiz, dado);
+    return balanceamento(raiz);
 }
 
 // Encontra o menor valor na árvore AVL
@@ -250,7 +257,7 @@ struct NoAVL *excluir(struct NoAVL *raiz, int valor) {
     }
 
     // Após a exclusão, chama a função de balanceamento para garantir que a árvore permaneça balanceada
-    return balanceamento(raiz, valor);
+    return balanceamento(raiz);
 }
 
 
@@ -309,6 +316,63 @@ void mostraArvore(struct NoAVL *a, int b)
         mostraArvore(a->esquerda, b + 1);
     }
 }
+
+// Acesso do snapshot (snapshot.h) aos nós desta árvore; a altura vai como dado auxiliar
+void *esquerdaSnapshot(const void *no)
+{
+    return ((const struct NoAVL *)no)->esquerda;
+}
+
+void *direitaSnapshot(const void *no)
+{
+    return ((const struct NoAVL *)no)->direita;
+}
+
+int32_t chaveSnapshot(const void *no)
+{
+    return ((const struct NoAVL *)no)->dado;
+}
+
+uint8_t alturaSnapshot(const void *no)
+{
+    return (uint8_t)((const struct NoAVL *)no)->altura;
+}
+
+void *criarSnapshot(int32_t chave, uint8_t altura)
+{
+    struct NoAVL *novoNo = criarNo(chave);
+    novoNo->altura = altura;
+    return novoNo;
+}
+
+void ligarSnapshot(void *pai, void *filho, int direita)
+{
+    if (direita)
+        ((struct NoAVL *)pai)->direita = (struct NoAVL *)filho;
+    else
+        ((struct NoAVL *)pai)->esquerda = (struct NoAVL *)filho;
+}
+
+void liberarSnapshot(void *no)
+{
+    free(no);
+}
+
+static const AcessoSnapshot acessoSnapshot = {SNAPSHOT_AVL, esquerdaSnapshot, direitaSnapshot, chaveSnapshot,
+                                              alturaSnapshot, criarSnapshot, ligarSnapshot, liberarSnapshot};
+
+// Função para salvar a árvore em um snapshot binário; retorna os nós gravados ou -1
+long long salvarArvore(struct NoAVL *raiz, const char *caminho)
+{
+    return salvarSnapshot(raiz, caminho, &acessoSnapshot);
+}
+
+// Função para carregar uma árvore salva por salvarArvore, com as alturas gravadas
+struct NoAVL *carregarArvore(const char *caminho)
+{
+    return (struct NoAVL *)carregarSnapshot(caminho, &acessoSnapshot);
+}
+
 /*
 3 - Escreva uma função para calcular a altura de uma árvore AVL.
 Peça ao usuário para inserir elementos em uma árvore AVL e, em seguida,
@@ -362,6 +426,54 @@ ou seja, se ela satisfaz todas as propriedades de uma árvore AVL.
  Teste sua função em diferentes árvores AVL, incluindo árvores corretas
  e incorretas, e verifique se a função retorna os resultados esperados.
 */
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK AVL.c -lm)
+void *benchCriar(void)
+{
+    return calloc(1, sizeof(struct NoAVL *));
+}
+
+void benchInserir(void *estrutura, int chave)
+{
+    struct NoAVL **raiz = (struct NoAVL **)estrutura;
+    *raiz = inserir(*raiz, chave);
+}
+
+int benchBuscar(void *estrutura, int chave)
+{
+    return buscarNo(*(struct NoAVL **)estrutura, chave) != NULL;
+}
+
+void benchRemover(void *estrutura, int chave)
+{
+    struct NoAVL **raiz = (struct NoAVL **)estrutura;
+    *raiz = excluir(*raiz, chave);
+}
+
+int benchAltura(void *estrutura)
+{
+    return altura(*(struct NoAVL **)estrutura) + 1; // Altura da raiz em níveis
+}
+
+long long benchSalvar(void *estrutura, const char *caminho)
+{
+    return salvarArvore(*(struct NoAVL **)estrutura, caminho);
+}
+
+void *benchCarregar(const char *caminho)
+{
+    struct NoAVL **raiz = (struct NoAVL **)calloc(1, sizeof(struct NoAVL *));
+    *raiz = carregarArvore(caminho);
+    return raiz;
+}
+
+int main(int argc, char *argv[])
+{
+    AdaptadorBench adaptador = {"avl", benchCriar, benchInserir, benchBuscar, benchRemover, benchAltura,
+                                benchSalvar, benchCarregar};
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main()
 {
 
@@ -421,5 +533,15 @@ int main()
     raiz = inserir(raiz, 21);
     mostraArvore(raiz, 3);
 
+    printf("\nSnapshot - Salva e recarrega -------------------\n");
+    if (salvarArvore(raiz, "avl.snapshot") >= 0)
+    {
+        raiz = carregarArvore("avl.snapshot");
+        mostraArvore(raiz, 3);
+        printf("Altura da raiz recarregada: %d\n", altura(raiz));
+        remove("avl.snapshot");
+    }
+
     return 0;
 }
+#endif
@@ -1,8 +1,19 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
-// Define a ordem da árvore B (ordem mínima = 3)
-#define ORDEM 3
+// Define a ordem da árvore B (máximo de filhos por nó)
+// Precisa ser par: a divisão preventiva separa ORDEM - 1 chaves em duas metades mais a mediana
+#define ORDEM 4
+
+// Parâmetros do filtro de Bloom em blocos
+#define PALAVRAS_POR_BLOCO 8                      // 8 x 64 bits = 64 bytes (uma linha de cache)
+#define BITS_POR_BLOCO (PALAVRAS_POR_BLOCO * 64)  // 512 bits por bloco
+#define CAPACIDADE_INICIAL_FILTRO 1024            // Chaves suportadas antes da primeira reconstrução
 
 // Estrutura de um nó da árvore B
 typedef struct No {
@@ -12,12 +23,28 @@ typedef struct No {
     int eh_folha;           // Flag para indicar se é nó folha
 } No;
 
+// Estrutura do filtro de Bloom em blocos
+// Cada chave cai em um único bloco de 64 bytes, então uma consulta toca só uma linha de cache
+typedef struct FiltroBloom {
+    void *memoria;              // Memória alocada (sem alinhamento)
+    uint64_t *blocos;           // Blocos alinhados em 64 bytes
+    long n_blocos;              // Quantidade de blocos
+    int bits_por_chave;         // Bits reservados por chave (controla a taxa de falsos positivos)
+    int n_hashes;               // Bits marcados por chave dentro do bloco
+    long capacidade;            // Chaves suportadas antes de reconstruir o filtro
+    long n_chaves;              // Chaves inseridas no filtro
+    long consultas;             // Buscas que passaram pelo filtro
+    long descidas_evitadas;     // Buscas respondidas pelo filtro sem descer na árvore
+    long falsos_positivos;      // Filtro disse "talvez" e a chave não estava na árvore
+} FiltroBloom;
+
 // Estrutura da árvore B
 typedef struct ArvoreB {
     No *raiz;              // Ponteiro para a raiz
     int ordem;             // Ordem da árvore
     int min_chaves;        // Mínimo de chaves por nó (exceto raiz)
     int max_chaves;        // Máximo de chaves por nó
+    FiltroBloom *filtro;   // Filtro de Bloom opcional (NULL quando desativado)
 } ArvoreB;
 
 // Função para criar um novo nó
@@ -42,10 +69,133 @@ ArvoreB* criarArvoreB() {
     arvore->ordem = ORDEM;
     arvore->min_chaves = ORDEM/2 - 1;
     arvore->max_chaves = ORDEM - 1;
+    arvore->filtro = NULL;
     
     return arvore;
 }
 
+// Função de espalhamento (finalizador do splitmix64)
+uint64_t espalharChave(int chave) {
+    uint64_t h = (uint64_t)(uint32_t)chave + 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+// Função para (re)alocar os blocos do filtro para a capacidade atual
+void alocarBlocosFiltro(FiltroBloom* filtro) {
+    long bits = filtro->capacidade * filtro->bits_por_chave;
+    filtro->n_blocos = (bits + BITS_POR_BLOCO - 1) / BITS_POR_BLOCO;
+    
+    // Aloca 63 bytes a mais para alinhar o início em uma linha de cache
+    size_t bytes = (size_t)filtro->n_blocos * PALAVRAS_POR_BLOCO * sizeof(uint64_t);
+    filtro->memoria = malloc(bytes + 63);
+    if (filtro->memoria == NULL) {
+        printf("Erro: Falha ao alocar memória para o filtro de Bloom.\n");
+        exit(-1);
+    }
+    filtro->blocos = (uint64_t*)(((uintptr_t)filtro->memoria + 63) & ~(uintptr_t)63);
+    memset(filtro->blocos, 0, bytes);
+    filtro->n_chaves = 0;
+}
+
+// Função para calcular o bloco e a posição dos bits de uma chave
+// Os n_hashes bits são derivados de duas metades do hash (h1 + i*h2)
+uint64_t* blocoDaChave(FiltroBloom* filtro, uint64_t h) {
+    uint64_t indice = ((h >> 32) * (uint64_t)filtro->n_blocos) >> 32;
+    return filtro->blocos + indice * PALAVRAS_POR_BLOCO;
+}
+
+// Função para marcar uma chave no filtro
+void adicionarNoFiltro(FiltroBloom* filtro, int chave) {
+    uint64_t h = espalharChave(chave);
+    uint64_t* bloco = blocoDaChave(filtro, h);
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 17) | 1;
+    
+    for (int i = 0; i < filtro->n_hashes; i++) {
+        uint32_t bit = (h1 + i * h2) % BITS_POR_BLOCO;
+        bloco[bit / 64] |= 1ULL << (bit % 64);
+    }
+    filtro->n_chaves++;
+}
+
+// Função para consultar o filtro: 0 = certamente ausente, 1 = talvez presente
+int talvezNoFiltro(FiltroBloom* filtro, int chave) {
+    uint64_t h = espalharChave(chave);
+    uint64_t* bloco = blocoDaChave(filtro, h);
+    uint32_t h1 = (uint32_t)h;
+    uint32_t h2 = (uint32_t)(h >> 17) | 1;
+    
+    for (int i = 0; i < filtro->n_hashes; i++) {
+        uint32_t bit = (h1 + i * h2) % BITS_POR_BLOCO;
+        if (!(bloco[bit / 64] & (1ULL << (bit % 64))))
+            return 0;
+    }
+    return 1;
+}
+
+// Função auxiliar para marcar no filtro todas as chaves de uma subárvore
+void adicionarSubarvoreNoFiltro(No* no, FiltroBloom* filtro) {
+    int i;
+    
+    for (i = 0; i < no->n_chaves; i++) {
+        if (!no->eh_folha)
+            adicionarSubarvoreNoFiltro(no->filhos[i], filtro);
+        adicionarNoFiltro(filtro, no->chaves[i]);
+    }
+    if (!no->eh_folha)
+        adicionarSubarvoreNoFiltro(no->filhos[i], filtro);
+}
+
+// Função para reconstruir o filtro com o dobro da capacidade quando ele enche
+// Sem isso a taxa de falsos positivos cresce sem limite conforme a árvore cresce
+void reconstruirFiltro(ArvoreB* arvore) {
+    FiltroBloom* filtro = arvore->filtro;
+    
+    free(filtro->memoria);
+    filtro->capacidade *= 2;
+    alocarBlocosFiltro(filtro);
+    adicionarSubarvoreNoFiltro(arvore->raiz, filtro);
+}
+
+// Função para ativar o filtro de Bloom na árvore
+// Chaves já existentes são adicionadas ao filtro
+void ativarFiltroBloom(ArvoreB* arvore, int bits_por_chave) {
+    FiltroBloom* filtro = (FiltroBloom*)malloc(sizeof(FiltroBloom));
+    
+    if (bits_por_chave < 1)
+        bits_por_chave = 1;
+    filtro->bits_por_chave = bits_por_chave;
+    
+    // Número ótimo de hashes: k = bits_por_chave * ln(2)
+    filtro->n_hashes = (int)(bits_por_chave * 0.693 + 0.5);
+    if (filtro->n_hashes < 1)
+        filtro->n_hashes = 1;
+    if (filtro->n_hashes > 16)
+        filtro->n_hashes = 16;
+    
+    filtro->capacidade = CAPACIDADE_INICIAL_FILTRO;
+    filtro->consultas = 0;
+    filtro->descidas_evitadas = 0;
+    filtro->falsos_positivos = 0;
+    
+    alocarBlocosFiltro(filtro);
+    arvore->filtro = filtro;
+    adicionarSubarvoreNoFiltro(arvore->raiz, filtro);
+    while (filtro->n_chaves > filtro->capacidade)
+        reconstruirFiltro(arvore);
+}
+
+// Função para desativar o filtro e liberar sua memória
+void desativarFiltroBloom(ArvoreB* arvore) {
+    if (arvore->filtro != NULL) {
+        free(arvore->filtro->memoria);
+        free(arvore->filtro);
+        arvore->filtro = NULL;
+    }
+}
+
 // Função para dividir um nó filho
 void dividirFilho(No* pai, int indice, No* filho) {
     // Cria novo nó que vai receber metade das chaves
@@ -121,6 +271,14 @@ void inserir(ArvoreB* arvore, int chave) {
     } else {
         inserirNaoCheio(raiz, chave);
     }
+    
+    // Mantém o filtro de Bloom atualizado
+    if (arvore->filtro != NULL) {
+        if (arvore->filtro->n_chaves >= arvore->filtro->capacidade)
+            reconstruirFiltro(arvore);
+        else
+            adicionarNoFiltro(arvore->filtro, chave);
+    }
 }
 
 // Função para buscar uma chave na árvore
@@ -143,6 +301,45 @@ No* buscar(No* no, int chave) {
     return buscar(no->filhos[i], chave);
 }
 
+// Função para buscar uma chave consultando antes o filtro de Bloom (se ativo)
+// Chaves ausentes são descartadas sem descer da raiz até a folha
+No* buscarNaArvore(ArvoreB* arvore, int chave) {
+    FiltroBloom* filtro = arvore->filtro;
+    
+    if (filtro == NULL)
+        return buscar(arvore->raiz, chave);
+    
+    filtro->consultas++;
+    if (!talvezNoFiltro(filtro, chave)) {
+        filtro->descidas_evitadas++;
+        return NULL;
+    }
+    
+    No* resultado = buscar(arvore->raiz, chave);
+    if (resultado == NULL)
+        filtro->falsos_positivos++;
+    return resultado;
+}
+
+// Função para imprimir as estatísticas do filtro de Bloom
+void imprimirEstatisticasFiltro(ArvoreB* arvore) {
+    FiltroBloom* filtro = arvore->filtro;
+    
+    if (filtro == NULL) {
+        printf("Filtro de Bloom desativado.\n");
+        return;
+    }
+    
+    long negativas = filtro->descidas_evitadas + filtro->falsos_positivos;
+    printf("Filtro de Bloom: %d bits/chave, %d hashes, %ld blocos de 64 bytes\n",
+           filtro->bits_por_chave, filtro->n_hashes, filtro->n_blocos);
+    printf("Consultas: %ld | Descidas evitadas: %ld | Falsos positivos: %ld",
+           filtro->consultas, filtro->descidas_evitadas, filtro->falsos_positivos);
+    if (negativas > 0)
+        printf(" (%.2f%% das chaves ausentes)", 100.0 * filtro->falsos_positivos / negativas);
+    printf("\n");
+}
+
 // Função para percorrer a árvore em ordem
 void percorrerEmOrdem(No* no) {
     int i;
@@ -160,6 +357,39 @@ void percorrerEmOrdem(No* no) {
 }
 
 // Função principal para teste
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK ArvoreB.c -lm)
+// A árvore B não tem remoção, então a mistura só busca e insere
+void* benchCriar(void) {
+    return criarArvoreB();
+}
+
+void benchInserir(void* estrutura, int chave) {
+    inserir((ArvoreB*)estrutura, chave);
+}
+
+int benchBuscar(void* estrutura, int chave) {
+    return buscarNaArvore((ArvoreB*)estrutura, chave) != NULL;
+}
+
+int benchAltura(void* estrutura) {
+    int niveis = 1;
+    No* no = ((ArvoreB*)estrutura)->raiz;
+    
+    // Todas as folhas estão no mesmo nível
+    while (!no->eh_folha) {
+        no = no->filhos[0];
+        niveis++;
+    }
+    return niveis;
+}
+
+int main(int argc, char* argv[]) {
+    AdaptadorBench adaptador = {.nome = "arvoreb", .criar = benchCriar, .inserir = benchInserir,
+                                .buscar = benchBuscar, .altura = benchAltura};
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main() {
     ArvoreB* arvore = criarArvoreB();
     
@@ -185,5 +415,19 @@ int main() {
     else
         printf("Chave %d não encontrada.\n", chave_busca);
     
+    // Testando o filtro de Bloom com buscas de chaves ausentes
+    ativarFiltroBloom(arvore, 10);
+    for (int chave = 1000; chave < 6000; chave++)
+        inserir(arvore, chave);
+    for (int chave = 100000; chave < 200000; chave++)
+        buscarNaArvore(arvore, chave);
+    
+    chave_busca = 17;
+    if (buscarNaArvore(arvore, chave_busca) != NULL)
+        printf("Chave %d encontrada!\n", chave_busca);
+    imprimirEstatisticasFiltro(arvore);
+    desativarFiltroBloom(arvore);
+    
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,718 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+// Árvore B somente-anexação (copy-on-write) com leituras MVCC
+// Uma escrita copia o caminho que modifica e publica a nova raiz de forma atômica.
+// Leitores abrem um snapshot sem travas e enxergam sempre uma versão consistente.
+// Compilar com: gcc -O2 -pthread ArvoreBMVCC.c
+
+// Define a ordem da árvore B (máximo de filhos por página, precisa ser par)
+#define ORDEM 64
+#define MAX_CHAVES (ORDEM - 1)
+#define MIN_GRAU (ORDEM / 2)
+
+// Diretório de páginas em memória: blocos fixos que nunca mudam de lugar
+#define PAGINAS_POR_BLOCO 4096
+#define MAX_BLOCOS 65536
+
+// Limite de leitores simultâneos (um slot por snapshot aberto)
+// Com os 64 slots ocupados, abrirLeitura espera (cedendo a CPU) até um leitor fechar
+#define MAX_LEITORES 64
+#define SLOT_LIVRE 0
+#define SLOT_RESERVADO UINT64_MAX
+
+#define ASSINATURA_ARQUIVO 0x43564D42u  // "BMVC"
+
+// Estrutura de uma página da árvore (mesmo formato em memória e no arquivo)
+typedef struct Pagina {
+    uint32_t id;                  // Número da página (0 = nenhuma)
+    uint32_t n_chaves;            // Número atual de chaves
+    uint32_t eh_folha;            // Flag para indicar se é página folha
+    uint32_t reservado;
+    uint64_t versao;              // Versão da escrita que criou a página
+    int chaves[MAX_CHAVES];       // Chaves ordenadas
+    uint32_t filhos[ORDEM];       // Números das páginas filhas
+} Pagina;
+
+// Cabeçalho gravado na página 0 do arquivo
+typedef struct Cabecalho {
+    uint32_t assinatura;
+    uint32_t raiz;
+    uint64_t versao;
+    uint32_t proxima_pagina;
+} Cabecalho;
+
+// Página aposentada: deixou de ser alcançável a partir da versão 'versao'
+typedef struct Aposentada {
+    uint32_t id;
+    uint64_t versao;
+} Aposentada;
+
+// Estrutura da árvore B MVCC
+typedef struct ArvoreMVCC {
+    int fd;                              // Arquivo de páginas (-1 = somente memória)
+    Pagina **diretorio;                  // Blocos de páginas (modo memória)
+    _Atomic uint64_t publicada;          // Versão (32 bits altos) e raiz (32 bits baixos)
+    _Atomic uint64_t leitores[MAX_LEITORES];  // Versão fixada por cada leitor
+    pthread_mutex_t trava_escrita;       // Apenas uma escrita por vez
+    uint32_t proxima_pagina;             // Próximo número de página nunca usado
+    uint32_t *livres;                    // Páginas liberadas para reuso
+    long n_livres, cap_livres;
+    Aposentada *aposentadas;             // Fila de páginas esperando leitores antigos
+    long ini_aposentadas, n_aposentadas, cap_aposentadas;
+    long paginas_reutilizadas;           // Estatística de recuperação
+} ArvoreMVCC;
+
+// Snapshot de leitura
+typedef struct Leitura {
+    ArvoreMVCC *arvore;
+    int slot;
+    uint64_t versao;
+    uint32_t raiz;
+} Leitura;
+
+// Transação de escrita
+typedef struct Escrita {
+    ArvoreMVCC *arvore;
+    uint64_t versao;              // Versão que será publicada
+    uint32_t raiz;                // Raiz da nova versão
+    uint32_t *copiadas;           // Páginas substituídas nesta transação
+    long n_copiadas, cap_copiadas;
+    uint32_t *criadas;            // Páginas criadas (devolvidas se a escrita for descartada)
+    long n_criadas, cap_criadas;
+} Escrita;
+
+uint64_t empacotarVersao(uint64_t versao, uint32_t raiz) {
+    return (versao << 32) | raiz;
+}
+
+// Função para aumentar um vetor dinâmico de páginas
+void anexarId(uint32_t **vetor, long *n, long *cap, uint32_t id) {
+    if (*n == *cap) {
+        *cap = *cap ? *cap * 2 : 64;
+        *vetor = (uint32_t *)realloc(*vetor, sizeof(uint32_t) * *cap);
+        if (*vetor == NULL) {
+            printf("Erro: Falha ao alocar memória.\n");
+            exit(-1);
+        }
+    }
+    (*vetor)[(*n)++] = id;
+}
+
+// ---------------------------------------------------------------------------
+// Armazenamento de páginas
+// ---------------------------------------------------------------------------
+
+// Função para obter uma página para leitura
+// Em memória devolve o ponteiro direto; em arquivo lê a página para 'buffer'
+const Pagina *obterPagina(ArvoreMVCC *arvore, uint32_t id, Pagina *buffer) {
+    if (arvore->fd < 0)
+        return &arvore->diretorio[id / PAGINAS_POR_BLOCO][id % PAGINAS_POR_BLOCO];
+
+    if (pread(arvore->fd, buffer, sizeof(Pagina), (off_t)id * sizeof(Pagina)) != sizeof(Pagina)) {
+        printf("Erro: Falha ao ler a página %u.\n", id);
+        exit(-1);
+    }
+    return buffer;
+}
+
+// Função para gravar uma página
+// Só é chamada para páginas que nenhum snapshot publicado alcança
+void gravarPagina(ArvoreMVCC *arvore, const Pagina *pagina) {
+    if (arvore->fd < 0) {
+        arvore->diretorio[pagina->id / PAGINAS_POR_BLOCO][pagina->id % PAGINAS_POR_BLOCO] = *pagina;
+        return;
+    }
+    if (pwrite(arvore->fd, pagina, sizeof(Pagina), (off_t)pagina->id * sizeof(Pagina)) != sizeof(Pagina)) {
+        printf("Erro: Falha ao gravar a página %u.\n", pagina->id);
+        exit(-1);
+    }
+}
+
+// Função para reservar um número de página (reaproveita páginas liberadas primeiro)
+uint32_t reservarPagina(ArvoreMVCC *arvore) {
+    if (arvore->n_livres > 0) {
+        arvore->paginas_reutilizadas++;
+        return arvore->livres[--arvore->n_livres];
+    }
+
+    uint32_t id = arvore->proxima_pagina++;
+    if (arvore->fd < 0 && arvore->diretorio[id / PAGINAS_POR_BLOCO] == NULL) {
+        if (id / PAGINAS_POR_BLOCO >= MAX_BLOCOS) {
+            printf("Erro: Limite de páginas atingido.\n");
+            exit(-1);
+        }
+        arvore->diretorio[id / PAGINAS_POR_BLOCO] = (Pagina *)malloc(sizeof(Pagina) * PAGINAS_POR_BLOCO);
+        if (arvore->diretorio[id / PAGINAS_POR_BLOCO] == NULL) {
+            printf("Erro: Falha ao alocar memória para as páginas.\n");
+            exit(-1);
+        }
+    }
+    return id;
+}
+
+// Função para gravar o cabeçalho com a raiz publicada (modo arquivo)
+void gravarCabecalho(ArvoreMVCC *arvore, uint64_t versao, uint32_t raiz) {
+    Cabecalho cab;
+    memset(&cab, 0, sizeof(cab));
+    cab.assinatura = ASSINATURA_ARQUIVO;
+    cab.raiz = raiz;
+    cab.versao = versao;
+    cab.proxima_pagina = arvore->proxima_pagina;
+
+    // Páginas primeiro, cabeçalho depois: uma queda nunca publica uma raiz incompleta
+    fsync(arvore->fd);
+    if (pwrite(arvore->fd, &cab, sizeof(cab), 0) != sizeof(cab)) {
+        printf("Erro: Falha ao gravar o cabeçalho.\n");
+        exit(-1);
+    }
+    fsync(arvore->fd);
+}
+
+// Função auxiliar para marcar as páginas alcançáveis a partir da raiz
+void marcarAlcancaveis(ArvoreMVCC *arvore, uint32_t id, unsigned char *marcas) {
+    Pagina buffer;
+    const Pagina *p = obterPagina(arvore, id, &buffer);
+    uint32_t filhos[ORDEM];
+    uint32_t n = p->eh_folha ? 0 : p->n_chaves + 1;
+
+    marcas[id] = 1;
+    memcpy(filhos, p->filhos, sizeof(uint32_t) * n);
+    for (uint32_t i = 0; i < n; i++)
+        marcarAlcancaveis(arvore, filhos[i], marcas);
+}
+
+// ---------------------------------------------------------------------------
+// Criação e abertura
+// ---------------------------------------------------------------------------
+
+// Função para criar a estrutura comum aos dois modos
+ArvoreMVCC *alocarArvore(int fd) {
+    ArvoreMVCC *arvore = (ArvoreMVCC *)calloc(1, sizeof(ArvoreMVCC));
+    arvore->fd = fd;
+    if (fd < 0)
+        arvore->diretorio = (Pagina **)calloc(MAX_BLOCOS, sizeof(Pagina *));
+    arvore->proxima_pagina = 1;  // Página 0 é reservada (cabeçalho / nenhuma)
+    for (int i = 0; i < MAX_LEITORES; i++)
+        atomic_init(&arvore->leitores[i], SLOT_LIVRE);
+    pthread_mutex_init(&arvore->trava_escrita, NULL);
+    return arvore;
+}
+
+// Função para criar uma raiz folha vazia na versão 1
+void criarRaizVazia(ArvoreMVCC *arvore) {
+    Pagina raiz;
+    memset(&raiz, 0, sizeof(raiz));
+    raiz.id = reservarPagina(arvore);
+    raiz.eh_folha = 1;
+    raiz.versao = 1;
+    gravarPagina(arvore, &raiz);
+    if (arvore->fd >= 0)
+        gravarCabecalho(arvore, 1, raiz.id);
+    atomic_init(&arvore->publicada, empacotarVersao(1, raiz.id));
+}
+
+// Função para criar uma árvore somente em memória
+ArvoreMVCC *criarArvoreMVCC() {
+    ArvoreMVCC *arvore = alocarArvore(-1);
+    criarRaizVazia(arvore);
+    return arvore;
+}
+
+// Função para abrir (ou criar) uma árvore sobre um arquivo
+// Páginas não alcançáveis pela raiz gravada voltam para a lista de livres
+ArvoreMVCC *abrirArvoreMVCC(const char *caminho) {
+    int fd = open(caminho, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        printf("Erro: Não foi possível abrir %s.\n", caminho);
+        return NULL;
+    }
+
+    ArvoreMVCC *arvore = alocarArvore(fd);
+    Cabecalho cab;
+    if (pread(fd, &cab, sizeof(cab), 0) != sizeof(cab) || cab.assinatura != ASSINATURA_ARQUIVO) {
+        criarRaizVazia(arvore);
+        return arvore;
+    }
+
+    arvore->proxima_pagina = cab.proxima_pagina;
+    atomic_init(&arvore->publicada, empacotarVersao(cab.versao, cab.raiz));
+
+    unsigned char *marcas = (unsigned char *)calloc(cab.proxima_pagina, 1);
+    marcarAlcancaveis(arvore, cab.raiz, marcas);
+    for (uint32_t id = 1; id < cab.proxima_pagina; id++)
+        if (!marcas[id])
+            anexarId(&arvore->livres, &arvore->n_livres, &arvore->cap_livres, id);
+    free(marcas);
+    return arvore;
+}
+
+// Função para liberar a árvore (não pode haver leitores nem escrita abertos)
+void fecharArvoreMVCC(ArvoreMVCC *arvore) {
+    if (arvore->fd >= 0) {
+        close(arvore->fd);
+    } else {
+        for (long i = 0; i < MAX_BLOCOS && arvore->diretorio[i] != NULL; i++)
+            free(arvore->diretorio[i]);
+        free(arvore->diretorio);
+    }
+    pthread_mutex_destroy(&arvore->trava_escrita);
+    free(arvore->livres);
+    free(arvore->aposentadas);
+    free(arvore);
+}
+
+// ---------------------------------------------------------------------------
+// Leitura (snapshot sem travas)
+// ---------------------------------------------------------------------------
+
+// Função para abrir um snapshot da versão publicada mais recente
+// O leitor fixa a versão no seu slot e confere se ela ainda é a publicada;
+// assim o escritor nunca reaproveita uma página que este snapshot alcança.
+// No máximo MAX_LEITORES snapshots ficam abertos ao mesmo tempo: sem slot livre,
+// a função bloqueia, cedendo a CPU com sched_yield, até que algum seja fechado.
+// Quem abre um snapshot sem fechar o anterior na mesma thread pode esperar para sempre.
+Leitura abrirLeitura(ArvoreMVCC *arvore) {
+    Leitura leitura;
+    leitura.arvore = arvore;
+    leitura.slot = -1;
+
+    while (leitura.slot < 0) {
+        for (int i = 0; i < MAX_LEITORES; i++) {
+            uint64_t esperado = SLOT_LIVRE;
+            if (atomic_compare_exchange_strong(&arvore->leitores[i], &esperado, SLOT_RESERVADO)) {
+                leitura.slot = i;
+                break;
+            }
+        }
+        if (leitura.slot < 0)
+            sched_yield();
+    }
+
+    uint64_t atual = atomic_load(&arvore->publicada);
+    for (;;) {
+        atomic_store(&arvore->leitores[leitura.slot], atual >> 32);
+        uint64_t conferida = atomic_load(&arvore->publicada);
+        if (conferida == atual)
+            break;
+        atual = conferida;
+    }
+
+    leitura.versao = atual >> 32;
+    leitura.raiz = (uint32_t)atual;
+    return leitura;
+}
+
+// Função para fechar o snapshot e liberar o slot
+void fecharLeitura(Leitura *leitura) {
+    atomic_store_explicit(&leitura->arvore->leitores[leitura->slot], SLOT_LIVRE, memory_order_release);
+    leitura->slot = -1;
+}
+
+// Função para buscar uma chave a partir de uma raiz
+int buscarAPartirDe(ArvoreMVCC *arvore, uint32_t id, int chave) {
+    Pagina buffer;
+
+    for (;;) {
+        const Pagina *p = obterPagina(arvore, id, &buffer);
+        uint32_t i = 0;
+
+        // Encontra a primeira chave maior ou igual
+        while (i < p->n_chaves && chave > p->chaves[i])
+            i++;
+
+        if (i < p->n_chaves && chave == p->chaves[i])
+            return 1;
+        if (p->eh_folha)
+            return 0;
+        id = p->filhos[i];
+    }
+}
+
+// Função para buscar uma chave no snapshot
+int buscarNaLeitura(Leitura *leitura, int chave) {
+    return buscarAPartirDe(leitura->arvore, leitura->raiz, chave);
+}
+
+// Função para contar as chaves de uma subárvore (usada para validar snapshots)
+long contarChaves(ArvoreMVCC *arvore, uint32_t id) {
+    Pagina buffer;
+    const Pagina *p = obterPagina(arvore, id, &buffer);
+    uint32_t filhos[ORDEM];
+    uint32_t n = p->eh_folha ? 0 : p->n_chaves + 1;
+    long total = p->n_chaves;
+
+    memcpy(filhos, p->filhos, sizeof(uint32_t) * n);
+    for (uint32_t i = 0; i < n; i++)
+        total += contarChaves(arvore, filhos[i]);
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+// Escrita (copy-on-write do caminho modificado)
+// ---------------------------------------------------------------------------
+
+// Função para iniciar uma transação de escrita sobre a versão publicada
+void iniciarEscrita(ArvoreMVCC *arvore, Escrita *escrita) {
+    pthread_mutex_lock(&arvore->trava_escrita);
+    uint64_t atual = atomic_load(&arvore->publicada);
+
+    memset(escrita, 0, sizeof(Escrita));
+    escrita->arvore = arvore;
+    escrita->versao = (atual >> 32) + 1;
+    escrita->raiz = (uint32_t)atual;
+}
+
+// Função para criar uma página nova pertencente à transação
+void novaPagina(Escrita *escrita, Pagina *pagina, int eh_folha) {
+    memset(pagina, 0, sizeof(Pagina));
+    pagina->id = reservarPagina(escrita->arvore);
+    pagina->eh_folha = eh_folha;
+    pagina->versao = escrita->versao;
+    anexarId(&escrita->criadas, &escrita->n_criadas, &escrita->cap_criadas, pagina->id);
+}
+
+// Função para ler uma página e garantir que ela pertence à transação
+// Páginas de versões publicadas nunca são alteradas: a cópia recebe um número novo
+void lerParaEscrita(Escrita *escrita, uint32_t id, Pagina *pagina) {
+    Pagina buffer;
+    *pagina = *obterPagina(escrita->arvore, id, &buffer);
+
+    if (pagina->versao != escrita->versao) {
+        anexarId(&escrita->copiadas, &escrita->n_copiadas, &escrita->cap_copiadas, id);
+        pagina->id = reservarPagina(escrita->arvore);
+        pagina->versao = escrita->versao;
+        anexarId(&escrita->criadas, &escrita->n_criadas, &escrita->cap_criadas, pagina->id);
+    }
+}
+
+// Função para dividir o filho cheio 'indice' de 'pai' (pai já pertence à transação)
+void dividirFilhoCOW(Escrita *escrita, Pagina *pai, uint32_t indice) {
+    Pagina filho, novo;
+    lerParaEscrita(escrita, pai->filhos[indice], &filho);
+    novaPagina(escrita, &novo, filho.eh_folha);
+
+    // Copia as chaves maiores para o novo nó
+    novo.n_chaves = MIN_GRAU - 1;
+    for (int j = 0; j < MIN_GRAU - 1; j++)
+        novo.chaves[j] = filho.chaves[j + MIN_GRAU];
+    if (!filho.eh_folha) {
+        for (int j = 0; j < MIN_GRAU; j++)
+            novo.filhos[j] = filho.filhos[j + MIN_GRAU];
+    }
+    filho.n_chaves = MIN_GRAU - 1;
+
+    // Abre espaço no pai para a chave mediana e o novo filho
+    for (int j = (int)pai->n_chaves; j >= (int)indice + 1; j--)
+        pai->filhos[j + 1] = pai->filhos[j];
+    for (int j = (int)pai->n_chaves - 1; j >= (int)indice; j--)
+        pai->chaves[j + 1] = pai->chaves[j];
+
+    pai->filhos[indice] = filho.id;
+    pai->filhos[indice + 1] = novo.id;
+    pai->chaves[indice] = filho.chaves[MIN_GRAU - 1];
+    pai->n_chaves++;
+
+    gravarPagina(escrita->arvore, &filho);
+    gravarPagina(escrita->arvore, &novo);
+}
+
+// Função para inserir uma chave na transação
+// Retorna 0 se a chave já existia (nada é copiado nesse caso)
+int inserirNaEscrita(Escrita *escrita, int chave) {
+    Pagina atual;
+
+    if (buscarAPartirDe(escrita->arvore, escrita->raiz, chave))
+        return 0;
+
+    // Se a raiz está cheia, cria nova raiz (a divisão já copia a raiz antiga)
+    Pagina buffer;
+    if (obterPagina(escrita->arvore, escrita->raiz, &buffer)->n_chaves == MAX_CHAVES) {
+        novaPagina(escrita, &atual, 0);
+        atual.filhos[0] = escrita->raiz;
+        dividirFilhoCOW(escrita, &atual, 0);
+    } else {
+        lerParaEscrita(escrita, escrita->raiz, &atual);
+    }
+    escrita->raiz = atual.id;
+
+    // Desce copiando cada página do caminho
+    while (!atual.eh_folha) {
+        int i = (int)atual.n_chaves - 1;
+        while (i >= 0 && atual.chaves[i] > chave)
+            i--;
+        i++;
+
+        if (obterPagina(escrita->arvore, atual.filhos[i], &buffer)->n_chaves == MAX_CHAVES) {
+            dividirFilhoCOW(escrita, &atual, i);
+            if (chave > atual.chaves[i])
+                i++;
+        }
+
+        Pagina filho;
+        lerParaEscrita(escrita, atual.filhos[i], &filho);
+        atual.filhos[i] = filho.id;
+        gravarPagina(escrita->arvore, &atual);
+        atual = filho;
+    }
+
+    // Insere na folha mantendo a ordem
+    int i = (int)atual.n_chaves - 1;
+    while (i >= 0 && atual.chaves[i] > chave) {
+        atual.chaves[i + 1] = atual.chaves[i];
+        i--;
+    }
+    atual.chaves[i + 1] = chave;
+    atual.n_chaves++;
+    gravarPagina(escrita->arvore, &atual);
+    return 1;
+}
+
+// Função para calcular a menor versão ainda fixada por algum leitor
+uint64_t menorVersaoFixada(ArvoreMVCC *arvore, uint64_t publicada) {
+    uint64_t menor = publicada;
+    for (int i = 0; i < MAX_LEITORES; i++) {
+        uint64_t v = atomic_load(&arvore->leitores[i]);
+        if (v != SLOT_LIVRE && v < menor)
+            menor = v;
+    }
+    return menor;
+}
+
+// Função para recuperar páginas que nenhum snapshot aberto ainda alcança
+// Uma página aposentada na versão v só é vista por snapshots de versão < v
+void recuperarPaginas(ArvoreMVCC *arvore, uint64_t publicada) {
+    uint64_t menor = menorVersaoFixada(arvore, publicada);
+
+    while (arvore->n_aposentadas > 0) {
+        Aposentada *a = &arvore->aposentadas[arvore->ini_aposentadas];
+        if (a->versao > menor)
+            break;
+        anexarId(&arvore->livres, &arvore->n_livres, &arvore->cap_livres, a->id);
+        arvore->ini_aposentadas = (arvore->ini_aposentadas + 1) % arvore->cap_aposentadas;
+        arvore->n_aposentadas--;
+    }
+}
+
+// Função para enfileirar uma página aposentada (fila circular)
+void aposentarPagina(ArvoreMVCC *arvore, uint32_t id, uint64_t versao) {
+    if (arvore->n_aposentadas == arvore->cap_aposentadas) {
+        long nova_cap = arvore->cap_aposentadas ? arvore->cap_aposentadas * 2 : 256;
+        Aposentada *nova = (Aposentada *)malloc(sizeof(Aposentada) * nova_cap);
+        for (long i = 0; i < arvore->n_aposentadas; i++)
+            nova[i] = arvore->aposentadas[(arvore->ini_aposentadas + i) % arvore->cap_aposentadas];
+        free(arvore->aposentadas);
+        arvore->aposentadas = nova;
+        arvore->cap_aposentadas = nova_cap;
+        arvore->ini_aposentadas = 0;
+    }
+    long fim = (arvore->ini_aposentadas + arvore->n_aposentadas) % arvore->cap_aposentadas;
+    arvore->aposentadas[fim].id = id;
+    arvore->aposentadas[fim].versao = versao;
+    arvore->n_aposentadas++;
+}
+
+// Função para liberar os vetores da transação e a trava de escrita
+void encerrarEscrita(Escrita *escrita) {
+    free(escrita->copiadas);
+    free(escrita->criadas);
+    pthread_mutex_unlock(&escrita->arvore->trava_escrita);
+}
+
+// Função para confirmar a escrita: publica a nova raiz de forma atômica
+void confirmarEscrita(Escrita *escrita) {
+    ArvoreMVCC *arvore = escrita->arvore;
+
+    if (escrita->n_criadas == 0) {  // Nada mudou
+        encerrarEscrita(escrita);
+        return;
+    }
+
+    if (arvore->fd >= 0)
+        gravarCabecalho(arvore, escrita->versao, escrita->raiz);
+    atomic_store(&arvore->publicada, empacotarVersao(escrita->versao, escrita->raiz));
+
+    for (long i = 0; i < escrita->n_copiadas; i++)
+        aposentarPagina(arvore, escrita->copiadas[i], escrita->versao);
+    recuperarPaginas(arvore, escrita->versao);
+    encerrarEscrita(escrita);
+}
+
+// Função para descartar a escrita: as páginas criadas nunca foram publicadas
+void descartarEscrita(Escrita *escrita) {
+    ArvoreMVCC *arvore = escrita->arvore;
+    for (long i = 0; i < escrita->n_criadas; i++)
+        anexarId(&arvore->livres, &arvore->n_livres, &arvore->cap_livres, escrita->criadas[i]);
+    encerrarEscrita(escrita);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: vazão de leitura com um escritor contínuo
+// ---------------------------------------------------------------------------
+
+#define CHAVES_INICIAIS 200000
+#define BUSCAS_POR_SNAPSHOT 1000
+#define CHAVES_POR_ESCRITA 100
+#define SEGUNDOS_POR_MEDICAO 2
+#define N_LEITORES 4
+
+typedef struct ContextoBenchmark {
+    ArvoreMVCC *arvore;
+    atomic_int parar;
+    atomic_long buscas;
+    atomic_long escritas;
+    unsigned semente;
+} ContextoBenchmark;
+
+// Gerador pseudoaleatório simples (xorshift) por thread
+unsigned proximoAleatorio(unsigned *estado) {
+    unsigned x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *estado = x;
+}
+
+void *threadLeitora(void *arg) {
+    ContextoBenchmark *ctx = (ContextoBenchmark *)arg;
+    unsigned estado = 2463534242u ^ (unsigned)(uintptr_t)&estado;
+    long total = 0;
+
+    while (!atomic_load(&ctx->parar)) {
+        Leitura leitura = abrirLeitura(ctx->arvore);
+        for (int i = 0; i < BUSCAS_POR_SNAPSHOT; i++)
+            buscarNaLeitura(&leitura, (int)(proximoAleatorio(&estado) % (CHAVES_INICIAIS * 4)));
+        fecharLeitura(&leitura);
+        total += BUSCAS_POR_SNAPSHOT;
+    }
+    atomic_fetch_add(&ctx->buscas, total);
+    return NULL;
+}
+
+void *threadEscritora(void *arg) {
+    ContextoBenchmark *ctx = (ContextoBenchmark *)arg;
+    unsigned estado = 88172645u;
+    long total = 0;
+
+    while (!atomic_load(&ctx->parar)) {
+        Escrita escrita;
+        iniciarEscrita(ctx->arvore, &escrita);
+        for (int i = 0; i < CHAVES_POR_ESCRITA; i++)
+            inserirNaEscrita(&escrita, (int)(proximoAleatorio(&estado) % (CHAVES_INICIAIS * 4)));
+        confirmarEscrita(&escrita);
+        total++;
+    }
+    atomic_fetch_add(&ctx->escritas, total);
+    return NULL;
+}
+
+// Função para medir a vazão de leitura com ou sem escritor concorrente
+void medirVazao(ArvoreMVCC *arvore, const char *modo, int com_escritor) {
+    ContextoBenchmark ctx;
+    pthread_t leitores[N_LEITORES], escritor;
+
+    ctx.arvore = arvore;
+    atomic_init(&ctx.parar, 0);
+    atomic_init(&ctx.buscas, 0);
+    atomic_init(&ctx.escritas, 0);
+
+    for (int i = 0; i < N_LEITORES; i++)
+        pthread_create(&leitores[i], NULL, threadLeitora, &ctx);
+    if (com_escritor)
+        pthread_create(&escritor, NULL, threadEscritora, &ctx);
+
+    sleep(SEGUNDOS_POR_MEDICAO);
+    atomic_store(&ctx.parar, 1);
+
+    for (int i = 0; i < N_LEITORES; i++)
+        pthread_join(leitores[i], NULL);
+    if (com_escritor)
+        pthread_join(escritor, NULL);
+
+    printf("%-8s | escritor %-3s | %d leitores | %12.0f buscas/s | %8.0f escritas/s | %ld páginas reutilizadas\n",
+           modo, com_escritor ? "sim" : "não", N_LEITORES,
+           (double)atomic_load(&ctx.buscas) / SEGUNDOS_POR_MEDICAO,
+           (double)atomic_load(&ctx.escritas) / SEGUNDOS_POR_MEDICAO,
+           arvore->paginas_reutilizadas);
+}
+
+// Função para carregar as chaves iniciais em escritas de 1000 chaves
+void carregarChaves(ArvoreMVCC *arvore) {
+    unsigned estado = 12345u;
+    Escrita escrita;
+
+    for (int i = 0; i < CHAVES_INICIAIS; i += 1000) {
+        iniciarEscrita(arvore, &escrita);
+        for (int j = 0; j < 1000; j++)
+            inserirNaEscrita(&escrita, (int)(proximoAleatorio(&estado) % (CHAVES_INICIAIS * 4)));
+        confirmarEscrita(&escrita);
+    }
+}
+
+// Função principal para teste
+int main() {
+    ArvoreMVCC *arvore = criarArvoreMVCC();
+    Escrita escrita;
+
+    // Inserindo alguns valores de teste
+    iniciarEscrita(arvore, &escrita);
+    int valores[] = {10, 20, 5, 6, 12, 30, 7, 17};
+    for (int i = 0; i < 8; i++)
+        inserirNaEscrita(&escrita, valores[i]);
+    confirmarEscrita(&escrita);
+
+    // Um snapshot aberto continua vendo a versão antiga durante novas escritas
+    Leitura leitura = abrirLeitura(arvore);
+    iniciarEscrita(arvore, &escrita);
+    for (int i = 100; i < 5000; i++)
+        inserirNaEscrita(&escrita, i);
+    confirmarEscrita(&escrita);
+
+    printf("Snapshot versão %llu: %ld chaves, chave 150 %s\n",
+           (unsigned long long)leitura.versao, contarChaves(arvore, leitura.raiz),
+           buscarNaLeitura(&leitura, 150) ? "encontrada" : "não encontrada");
+    fecharLeitura(&leitura);
+
+    leitura = abrirLeitura(arvore);
+    printf("Snapshot versão %llu: %ld chaves, chave 150 %s\n",
+           (unsigned long long)leitura.versao, contarChaves(arvore, leitura.raiz),
+           buscarNaLeitura(&leitura, 150) ? "encontrada" : "não encontrada");
+    fecharLeitura(&leitura);
+    fecharArvoreMVCC(arvore);
+
+    // Benchmark em memória e sobre arquivo
+    printf("\nBenchmark (%d chaves iniciais, %d buscas por snapshot, %d chaves por escrita):\n",
+           CHAVES_INICIAIS, BUSCAS_POR_SNAPSHOT, CHAVES_POR_ESCRITA);
+
+    arvore = criarArvoreMVCC();
+    carregarChaves(arvore);
+    medirVazao(arvore, "memória", 0);
+    medirVazao(arvore, "memória", 1);
+    fecharArvoreMVCC(arvore);
+
+    const char *caminho = "arvore_mvcc.db";
+    remove(caminho);
+    arvore = abrirArvoreMVCC(caminho);
+    carregarChaves(arvore);
+    medirVazao(arvore, "arquivo", 0);
+    medirVazao(arvore, "arquivo", 1);
+    long total = contarChaves(arvore, (uint32_t)atomic_load(&arvore->publicada));
+    fecharArvoreMVCC(arvore);
+
+    // Reabrir o arquivo recupera a última raiz publicada
+    arvore = abrirArvoreMVCC(caminho);
+    printf("Arquivo reaberto: %ld chaves (esperado %ld), %ld páginas livres\n",
+           contarChaves(arvore, (uint32_t)atomic_load(&arvore->publicada)), total, arvore->n_livres);
+    fecharArvoreMVCC(arvore);
+    remove(caminho);
+
+    return 0;
+}
@@ -0,0 +1,413 @@
+#include <stdio.h>   // Inclui a biblioteca padrão de entrada e saída
+#include <stdlib.h>  // Inclui a biblioteca padrão de alocação de memória
+#include <stdint.h>
+#include <string.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece os temporizadores
+#endif
+
+// Representação sucinta, somente leitura, de uma árvore binária de busca.
+//
+// Forma: os nós são numerados de 0 a n-1 em ordem de largura e cada nó x
+// ocupa dois bits no mapa, bit 2x = tem filho esquerdo e bit 2x+1 = tem filho
+// direito (2 bits por nó). Como os filhos aparecem no mapa na mesma ordem em
+// que são numerados, o k-ésimo bit 1 corresponde ao nó k:
+//   filho em p   = rank1(p + 1)   (uns em [0, p])
+//   pai(x)       = select1(x) / 2 (posição do x-ésimo 1)
+// Chaves: em ordem de largura, com (chave - mínimo) empacotada na menor
+// largura de bits que comporta o intervalo.
+// O rank usa um contador de 32 bits a cada 512 bits (+0,125 bit por nó); o
+// select parte de uma amostra a cada 4096 uns (+0,016 bit por nó).
+
+#define BITS_BLOCO 512                  // Bits por bloco do rank (8 palavras)
+#define PALAVRAS_BLOCO (BITS_BLOCO / 64)
+#define AMOSTRA_SELECT 4096             // Uns entre duas amostras do select
+#define NENHUM -1L                      // Filho ou pai inexistente
+
+// Estrutura da árvore sucinta
+typedef struct ArvoreSucinta {
+    long n;              // Número de nós
+    uint64_t* bits;      // Mapa da forma (2 bits por nó, em ordem de largura)
+    uint32_t* blocos;    // blocos[b] = uns antes do bloco b
+    uint32_t* amostras;  // amostras[j] = bloco que contém o (j*AMOSTRA_SELECT+1)-ésimo 1
+    uint64_t* chaves;    // Chaves empacotadas em ordem de largura
+    int largura;         // Bits por chave
+    int minimo;          // Somado a cada chave desempacotada
+} ArvoreSucinta;
+
+// Estrutura de um nó da árvore binária (origem da codificação e comparação)
+typedef struct NoArvore {
+    int dado;
+    struct NoArvore* esquerda;
+    struct NoArvore* direita;
+} NoArvore;
+
+// Função para alocar zerado ou encerrar com erro
+void* alocarZerado(size_t quantidade, size_t tamanho) {
+    void* p = calloc(quantidade, tamanho);
+    if (p == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    return p;
+}
+
+// Função para criar uma árvore sucinta vazia com espaço para n nós
+ArvoreSucinta* criarArvoreSucinta(long n, int minimo, int maximo) {
+    ArvoreSucinta* arvore = (ArvoreSucinta*)alocarZerado(1, sizeof(ArvoreSucinta));
+    uint32_t intervalo = (uint32_t)maximo - (uint32_t)minimo;
+
+    arvore->n = n;
+    arvore->minimo = minimo;
+    arvore->largura = intervalo == 0 ? 0 : 32 - __builtin_clz(intervalo);
+
+    // Uma palavra a mais em cada vetor: rank(2n) e a leitura de chaves olham a palavra seguinte
+    long palavras = (2 * n + 63) / 64 + 1;
+    arvore->bits = (uint64_t*)alocarZerado(palavras, sizeof(uint64_t));
+    arvore->chaves = (uint64_t*)alocarZerado((n * arvore->largura + 63) / 64 + 1, sizeof(uint64_t));
+    arvore->blocos = (uint32_t*)alocarZerado((2 * n) / BITS_BLOCO + 2, sizeof(uint32_t));
+    arvore->amostras = (uint32_t*)alocarZerado(n / AMOSTRA_SELECT + 2, sizeof(uint32_t));
+    return arvore;
+}
+
+void liberarArvoreSucinta(ArvoreSucinta* arvore) {
+    free(arvore->bits);
+    free(arvore->chaves);
+    free(arvore->blocos);
+    free(arvore->amostras);
+    free(arvore);
+}
+
+// Função para gravar o nó x (em ordem de largura) durante a codificação
+void definirNoSucinta(ArvoreSucinta* arvore, long x, int chave, int temEsquerdo, int temDireito) {
+    if (temEsquerdo)
+        arvore->bits[(2 * x) >> 6] |= 1ULL << ((2 * x) & 63);
+    if (temDireito)
+        arvore->bits[(2 * x + 1) >> 6] |= 1ULL << ((2 * x + 1) & 63);
+
+    uint64_t valor = (uint32_t)chave - (uint32_t)arvore->minimo;
+    uint64_t posicao = (uint64_t)x * arvore->largura;
+    int deslocamento = posicao & 63;
+    arvore->chaves[posicao >> 6] |= valor << deslocamento;
+    if (deslocamento + arvore->largura > 64)
+        arvore->chaves[(posicao >> 6) + 1] |= valor >> (64 - deslocamento);
+}
+
+// Função para montar os índices de rank e select depois que todos os nós foram gravados
+void finalizarArvoreSucinta(ArvoreSucinta* arvore) {
+    long palavras = (2 * arvore->n + 63) / 64;
+    uint32_t uns = 0;
+    long proximaAmostra = 1;  // Número do próximo 1 a ser amostrado
+
+    for (long w = 0; w < palavras; w++) {
+        if (w % PALAVRAS_BLOCO == 0)
+            arvore->blocos[w / PALAVRAS_BLOCO] = uns;
+        uint32_t aqui = __builtin_popcountll(arvore->bits[w]);
+        while (proximaAmostra <= (long)uns + aqui) {
+            arvore->amostras[(proximaAmostra - 1) / AMOSTRA_SELECT] = w / PALAVRAS_BLOCO;
+            proximaAmostra += AMOSTRA_SELECT;
+        }
+        uns += aqui;
+    }
+    arvore->blocos[(palavras + PALAVRAS_BLOCO - 1) / PALAVRAS_BLOCO] = uns;
+}
+
+// Função para contar os uns em [0, i): um contador de bloco e até 8 popcounts
+static inline long rank1(const ArvoreSucinta* arvore, uint64_t i) {
+    uint64_t palavra = i >> 6;
+    long uns = arvore->blocos[i / BITS_BLOCO];
+    for (uint64_t w = (i / BITS_BLOCO) * PALAVRAS_BLOCO; w < palavra; w++)
+        uns += __builtin_popcountll(arvore->bits[w]);
+    return uns + __builtin_popcountll(arvore->bits[palavra] & ((1ULL << (i & 63)) - 1));
+}
+
+// Função para encontrar a posição do k-ésimo 1 (k >= 1)
+static inline uint64_t select1(const ArvoreSucinta* arvore, long k) {
+    uint64_t bloco = arvore->amostras[(k - 1) / AMOSTRA_SELECT];
+    while (arvore->blocos[bloco + 1] < k)  // Poucos blocos: a densidade de uns é ~1/2
+        bloco++;
+
+    long resto = k - arvore->blocos[bloco];
+    uint64_t w = bloco * PALAVRAS_BLOCO;
+    for (;; w++) {
+        long aqui = __builtin_popcountll(arvore->bits[w]);
+        if (resto <= aqui)
+            break;
+        resto -= aqui;
+    }
+
+    uint64_t palavra = arvore->bits[w];
+    while (--resto > 0)
+        palavra &= palavra - 1;  // Apaga os uns anteriores
+    return w * 64 + __builtin_ctzll(palavra);
+}
+
+// Funções de navegação: O(1) por passo
+long raizSucinta(const ArvoreSucinta* arvore) {
+    return arvore->n > 0 ? 0 : NENHUM;
+}
+
+long esquerdoSucinta(const ArvoreSucinta* arvore, long x) {
+    uint64_t p = 2 * (uint64_t)x;
+    if (!(arvore->bits[p >> 6] >> (p & 63) & 1))
+        return NENHUM;
+    return rank1(arvore, p + 1);
+}
+
+long direitoSucinta(const ArvoreSucinta* arvore, long x) {
+    uint64_t p = 2 * (uint64_t)x + 1;
+    if (!(arvore->bits[p >> 6] >> (p & 63) & 1))
+        return NENHUM;
+    return rank1(arvore, p + 1);
+}
+
+long paiSucinta(const ArvoreSucinta* arvore, long x) {
+    if (x == 0)
+        return NENHUM;
+    return (long)(select1(arvore, x) / 2);
+}
+
+int chaveSucinta(const ArvoreSucinta* arvore, long x) {
+    uint64_t posicao = (uint64_t)x * arvore->largura;
+    int deslocamento = posicao & 63;
+    uint64_t valor = arvore->chaves[posicao >> 6] >> deslocamento;
+    if (deslocamento + arvore->largura > 64)
+        valor |= arvore->chaves[(posicao >> 6) + 1] << (64 - deslocamento);
+    return (int)((uint32_t)(valor & ((1ULL << arvore->largura) - 1)) + (uint32_t)arvore->minimo);
+}
+
+// Função para buscar uma chave; retorna o número do nó ou NENHUM
+long buscarSucinta(const ArvoreSucinta* arvore, int chave) {
+    long x = raizSucinta(arvore);
+    while (x != NENHUM) {
+        int atual = chaveSucinta(arvore, x);
+        if (chave == atual)
+            return x;
+        x = chave < atual ? esquerdoSucinta(arvore, x) : direitoSucinta(arvore, x);
+    }
+    return NENHUM;
+}
+
+// Função para codificar diretamente a árvore que inserirElementos montaria
+// com o vetor ordenado, sem criar nós: uma fila de intervalos em ordem de largura
+ArvoreSucinta* codificarVetor(const int vetor[], long n) {
+    ArvoreSucinta* arvore = criarArvoreSucinta(n, n > 0 ? vetor[0] : 0, n > 0 ? vetor[n - 1] : 0);
+    long* fila = (long*)malloc(sizeof(long) * 2 * (n > 0 ? n : 1));
+    if (fila == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    long frente = 0, fim = 0;
+    if (n > 0) {
+        fila[fim++] = 0;
+        fila[fim++] = n - 1;
+    }
+    for (long x = 0; frente < fim; x++) {
+        long inicio = fila[frente++], ultimo = fila[frente++];
+        long meio = (inicio + ultimo) / 2;
+        int temEsquerdo = inicio <= meio - 1, temDireito = meio + 1 <= ultimo;
+        definirNoSucinta(arvore, x, vetor[meio], temEsquerdo, temDireito);
+        if (temEsquerdo) {
+            fila[fim++] = inicio;
+            fila[fim++] = meio - 1;
+        }
+        if (temDireito) {
+            fila[fim++] = meio + 1;
+            fila[fim++] = ultimo;
+        }
+    }
+    free(fila);
+    finalizarArvoreSucinta(arvore);
+    return arvore;
+}
+
+long contarNos(NoArvore* raiz) {
+    return raiz == NULL ? 0 : 1 + contarNos(raiz->esquerda) + contarNos(raiz->direita);
+}
+
+// Função para codificar uma árvore binária de busca qualquer
+ArvoreSucinta* codificarArvore(NoArvore* raiz) {
+    long n = contarNos(raiz);
+    NoArvore *menor = raiz, *maior = raiz;
+    while (menor != NULL && menor->esquerda != NULL)
+        menor = menor->esquerda;
+    while (maior != NULL && maior->direita != NULL)
+        maior = maior->direita;
+
+    ArvoreSucinta* arvore = criarArvoreSucinta(n, menor ? menor->dado : 0, maior ? maior->dado : 0);
+    NoArvore** fila = (NoArvore**)malloc(sizeof(NoArvore*) * (n > 0 ? n : 1));
+    if (fila == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    long frente = 0, fim = 0;
+    if (raiz != NULL)
+        fila[fim++] = raiz;
+    for (long x = 0; frente < fim; x++) {
+        NoArvore* no = fila[frente++];
+        definirNoSucinta(arvore, x, no->dado, no->esquerda != NULL, no->direita != NULL);
+        if (no->esquerda != NULL)
+            fila[fim++] = no->esquerda;
+        if (no->direita != NULL)
+            fila[fim++] = no->direita;
+    }
+    free(fila);
+    finalizarArvoreSucinta(arvore);
+    return arvore;
+}
+
+// Função para calcular os bytes ocupados pela árvore sucinta
+size_t tamanhoSucinta(const ArvoreSucinta* arvore) {
+    long n = arvore->n;
+    return sizeof(ArvoreSucinta) + ((2 * n + 63) / 64 + 1) * sizeof(uint64_t) +
+           ((n * arvore->largura + 63) / 64 + 1) * sizeof(uint64_t) +
+           ((2 * n) / BITS_BLOCO + 2) * sizeof(uint32_t) + (n / AMOSTRA_SELECT + 2) * sizeof(uint32_t);
+}
+
+// Funções da árvore de ponteiros para comparação
+NoArvore* criarNo(int dado) {
+    NoArvore* novoNo = (NoArvore*)malloc(sizeof(NoArvore));
+    if (novoNo == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    novoNo->dado = dado;
+    novoNo->esquerda = NULL;
+    novoNo->direita = NULL;
+    return novoNo;
+}
+
+NoArvore* inserirElementos(const int vetor[], long inicio, long fim) {
+    if (inicio > fim)
+        return NULL;
+    long meio = (inicio + fim) / 2;
+    NoArvore* novoNo = criarNo(vetor[meio]);
+    novoNo->esquerda = inserirElementos(vetor, inicio, meio - 1);
+    novoNo->direita = inserirElementos(vetor, meio + 1, fim);
+    return novoNo;
+}
+
+NoArvore* buscarElemento(NoArvore* raiz, int dado) {
+    while (raiz != NULL && raiz->dado != dado)
+        raiz = dado < raiz->dado ? raiz->esquerda : raiz->direita;
+    return raiz;
+}
+
+void liberarArvore(NoArvore* raiz) {
+    if (raiz != NULL) {
+        liberarArvore(raiz->esquerda);
+        liberarArvore(raiz->direita);
+        free(raiz);
+    }
+}
+
+#ifdef BENCHMARK
+// Benchmark de espaço e busca (gcc -O2 -DBENCHMARK ArvoreSucinta.c -lm)
+// Uso: ./bench [n]  (padrão 10^7); chaves 0, 2, 4, ... e metade das consultas ausentes
+// bytes_por_no da árvore de ponteiros conta só o pedido ao malloc (sem o cabeçalho dele)
+
+#define CONSULTAS 1000000
+
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    int* vetor = (int*)malloc(sizeof(int) * n);
+    int* consultas = (int*)malloc(sizeof(int) * CONSULTAS);
+    for (long i = 0; i < n; i++)
+        vetor[i] = (int)(2 * i);
+    for (int i = 0; i < CONSULTAS; i++)
+        consultas[i] = (int)(benchAleatorio() % (uint64_t)(2 * n));
+
+    long long antes = bench_bytes_vivos;
+    NoArvore* raiz = inserirElementos(vetor, 0, n - 1);
+    double bytesPonteiros = (double)(bench_bytes_vivos - antes) / n;
+
+    ArvoreSucinta* arvore = codificarVetor(vetor, n);
+    long tamanho = (long)tamanhoSucinta(arvore);
+    double bitsForma = (double)(tamanho - ((n * arvore->largura + 63) / 64 + 1) * 8) * 8 / n;
+
+    printf("variante,n,bytes_por_no,bits_forma_por_no,ns_busca,encontradas\n");
+
+    long encontradas = 0;
+    uint64_t inicio = benchAgoraNs();
+    for (int i = 0; i < CONSULTAS; i++)
+        encontradas += buscarElemento(raiz, consultas[i]) != NULL;
+    printf("ponteiros,%ld,%.2f,%.2f,%.1f,%ld\n", n, bytesPonteiros, 128.0,
+           (double)(benchAgoraNs() - inicio) / CONSULTAS, encontradas);
+
+    encontradas = 0;
+    inicio = benchAgoraNs();
+    for (int i = 0; i < CONSULTAS; i++)
+        encontradas += buscarSucinta(arvore, consultas[i]) != NENHUM;
+    printf("sucinta,%ld,%.2f,%.2f,%.1f,%ld\n", n, (double)tamanho / n, bitsForma,
+           (double)(benchAgoraNs() - inicio) / CONSULTAS, encontradas);
+
+    liberarArvore(raiz);
+    liberarArvoreSucinta(arvore);
+    free(consultas);
+    free(vetor);
+    return 0;
+}
+#else
+void imprimirSubarvore(const ArvoreSucinta* arvore, long x) {
+    if (x == NENHUM)
+        return;
+    printf("(");
+    imprimirSubarvore(arvore, esquerdoSucinta(arvore, x));
+    printf(" %d ", chaveSucinta(arvore, x));
+    imprimirSubarvore(arvore, direitoSucinta(arvore, x));
+    printf(")");
+}
+
+// Função principal para testar a árvore sucinta
+int main() {
+    int vetor[] = {10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
+    long n = sizeof(vetor) / sizeof(vetor[0]);
+
+    ArvoreSucinta* arvore = codificarVetor(vetor, n);
+
+    printf("Mapa da forma (2 bits por nó): ");
+    for (long p = 0; p < 2 * n; p++)
+        printf("%d%s", (int)(arvore->bits[p >> 6] >> (p & 63) & 1), p % 2 ? " " : "");
+    printf("\n");
+    printf("Chaves em ordem de largura (%d bits cada): ", arvore->largura);
+    for (long x = 0; x < n; x++)
+        printf("%d ", chaveSucinta(arvore, x));
+    printf("\n");
+
+    printf("Árvore: ");
+    imprimirSubarvore(arvore, raizSucinta(arvore));
+    printf("\n");
+
+    int testes[] = {70, 35, 100};
+    for (int i = 0; i < 3; i++) {
+        long x = buscarSucinta(arvore, testes[i]);
+        if (x == NENHUM) {
+            printf("Chave %d: ausente\n", testes[i]);
+            continue;
+        }
+        printf("Chave %d: nó %ld, caminho até a raiz:", testes[i], x);
+        for (; x != NENHUM; x = paiSucinta(arvore, x))
+            printf(" %d", chaveSucinta(arvore, x));
+        printf("\n");
+    }
+
+    // Codificação de uma árvore de busca qualquer (desbalanceada)
+    NoArvore* raiz = criarNo(50);
+    raiz->esquerda = criarNo(20);
+    raiz->esquerda->direita = criarNo(30);
+    raiz->direita = criarNo(90);
+    raiz->direita->esquerda = criarNo(60);
+    raiz->direita->esquerda->direita = criarNo(70);
+    ArvoreSucinta* outra = codificarArvore(raiz);
+    printf("Árvore desbalanceada: ");
+    imprimirSubarvore(outra, raizSucinta(outra));
+    printf("\n");
+
+    liberarArvore(raiz);
+    liberarArvoreSucinta(outra);
+    liberarArvoreSucinta(arvore);
+    return 0;
+}
+#endif
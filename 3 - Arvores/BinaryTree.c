@@ -1,5 +1,10 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include "snapshot.h"  // Formato binário para salvar e carregar a árvore
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
 struct NoArvore
 {
@@ -8,6 +13,18 @@ struct NoArvore
     struct NoArvore *direita;
 };
 
+// Modo bode expiatório (scapegoat): a árvore guarda apenas o tamanho, os nós não mudam
+// Altura máxima com alfa = 0.9 e 2^31 chaves fica abaixo de 210 níveis
+#define MAX_PROFUNDIDADE 256
+
+struct ArvoreBodeExpiatorio
+{
+    struct NoArvore *raiz;
+    int n;         // Número de nós
+    int max_n;     // Maior n desde a última reconstrução completa
+    double alfa;   // Fator de balanceamento (0.5 < alfa < 1)
+};
+
 struct NoArvore *criarNo(int dado)
 {
     struct NoArvore *novoNo = (struct NoArvore *)malloc(sizeof(struct NoArvore));
@@ -91,6 +108,233 @@ struct NoArvore *excluir(struct NoArvore *raiz, int valor)
     return raiz;
 }
 
+// Função para transformar a árvore em uma "espinha" (lista encadeada pela direita)
+// usando rotações à direita; 'pseudoRaiz' é um nó auxiliar cuja direita é a raiz
+// Retorna o número de nós (Day-Stout-Warren, fase 1)
+int arvoreParaEspinha(struct NoArvore *pseudoRaiz)
+{
+    struct NoArvore *cauda = pseudoRaiz;
+    struct NoArvore *resto = cauda->direita;
+    int n = 0;
+
+    while (resto != NULL)
+    {
+        if (resto->esquerda == NULL)
+        {
+            cauda = resto;
+            resto = resto->direita;
+            n++;
+        }
+        else
+        {
+            // Rotação à direita em torno de 'resto'
+            struct NoArvore *temp = resto->esquerda;
+            resto->esquerda = temp->direita;
+            temp->direita = resto;
+            resto = temp;
+            cauda->direita = temp;
+        }
+    }
+    return n;
+}
+
+// Função auxiliar que faz 'm' rotações à esquerda ao longo da espinha
+void compactarEspinha(struct NoArvore *pseudoRaiz, int m)
+{
+    struct NoArvore *varredor = pseudoRaiz;
+    int i;
+    for (i = 0; i < m; i++)
+    {
+        struct NoArvore *filho = varredor->direita;
+        varredor->direita = filho->direita;
+        varredor = varredor->direita;
+        filho->direita = varredor->esquerda;
+        varredor->esquerda = filho;
+    }
+}
+
+// Função para transformar a espinha de 'n' nós em uma árvore completa (DSW, fase 2)
+void espinhaParaArvore(struct NoArvore *pseudoRaiz, int n)
+{
+    int completa = 1;
+    while (completa * 2 <= n + 1)
+        completa *= 2;
+
+    // Primeiro posiciona as folhas do último nível incompleto
+    int folhas = n + 1 - completa;
+    compactarEspinha(pseudoRaiz, folhas);
+    n -= folhas;
+    while (n > 1)
+    {
+        n /= 2;
+        compactarEspinha(pseudoRaiz, n);
+    }
+}
+
+// Função para rebalancear a (sub)árvore em tempo linear e memória O(1) (Day-Stout-Warren)
+// Retorna a nova raiz; pode ser chamada a qualquer momento sobre uma árvore comum
+struct NoArvore *rebalancearDSW(struct NoArvore *raiz)
+{
+    struct NoArvore pseudoRaiz;
+    pseudoRaiz.esquerda = NULL;
+    pseudoRaiz.direita = raiz;
+
+    int n = arvoreParaEspinha(&pseudoRaiz);
+    espinhaParaArvore(&pseudoRaiz, n);
+    return pseudoRaiz.direita;
+}
+
+// Função para contar os nós de uma subárvore
+int tamanhoSubarvore(struct NoArvore *raiz)
+{
+    if (raiz == NULL)
+        return 0;
+    return 1 + tamanhoSubarvore(raiz->esquerda) + tamanhoSubarvore(raiz->direita);
+}
+
+// Função para criar uma árvore no modo bode expiatório
+struct ArvoreBodeExpiatorio *criarArvoreBodeExpiatorio(double alfa)
+{
+    struct ArvoreBodeExpiatorio *arvore = (struct ArvoreBodeExpiatorio *)malloc(sizeof(struct ArvoreBodeExpiatorio));
+    if (arvore == NULL)
+    {
+        printf("Erro: Falha ao alocar memória para a árvore.\n");
+        exit(-1);
+    }
+    if (alfa < 0.55)
+        alfa = 0.55;
+    if (alfa > 0.9)
+        alfa = 0.9;
+    arvore->raiz = NULL;
+    arvore->n = 0;
+    arvore->max_n = 0;
+    arvore->alfa = alfa;
+    return arvore;
+}
+
+// Função para adotar uma árvore comum no modo bode expiatório (rebalanceia uma vez com DSW)
+void adotarArvore(struct ArvoreBodeExpiatorio *arvore, struct NoArvore *raiz)
+{
+    arvore->raiz = rebalancearDSW(raiz);
+    arvore->n = tamanhoSubarvore(arvore->raiz);
+    arvore->max_n = arvore->n;
+}
+
+// Função para calcular a profundidade máxima permitida: log de n na base 1/alfa
+int profundidadeAlfa(struct ArvoreBodeExpiatorio *arvore)
+{
+    return (int)(log((double)arvore->n) / log(1.0 / arvore->alfa));
+}
+
+// Função para inserir no modo bode expiatório
+// Se o novo nó ficar fundo demais, sobe pelo caminho até o primeiro ancestral
+// desbalanceado (o bode expiatório) e reconstrói só a subárvore dele
+void inserirBodeExpiatorio(struct ArvoreBodeExpiatorio *arvore, int dado)
+{
+    struct NoArvore *caminho[MAX_PROFUNDIDADE];
+    int profundidade = 0;
+    struct NoArvore *novoNo = criarNo(dado);
+
+    arvore->n++;
+    if (arvore->n > arvore->max_n)
+        arvore->max_n = arvore->n;
+
+    if (arvore->raiz == NULL)
+    {
+        arvore->raiz = novoNo;
+        return;
+    }
+
+    // Inserção comum guardando o caminho percorrido
+    struct NoArvore *atual = arvore->raiz;
+    while (1)
+    {
+        // Só uma árvore que não foi montada aqui passa do limite: reconstrói tudo com DSW e recomeça
+        if (profundidade == MAX_PROFUNDIDADE)
+        {
+            arvore->raiz = rebalancearDSW(arvore->raiz);
+            atual = arvore->raiz;
+            profundidade = 0;
+        }
+        caminho[profundidade++] = atual;
+        if (dado <= atual->dado)
+        {
+            if (atual->esquerda == NULL)
+            {
+                atual->esquerda = novoNo;
+                break;
+            }
+            atual = atual->esquerda;
+        }
+        else
+        {
+            if (atual->direita == NULL)
+            {
+                atual->direita = novoNo;
+                break;
+            }
+            atual = atual->direita;
+        }
+    }
+
+    if (profundidade <= profundidadeAlfa(arvore))
+        return;
+
+    // Procura o bode expiatório: tamanho(filho) > alfa * tamanho(pai)
+    struct NoArvore *filho = novoNo;
+    int tamanhoFilho = 1;
+    int i;
+    for (i = profundidade - 1; i >= 0; i--)
+    {
+        struct NoArvore *pai = caminho[i];
+        struct NoArvore *irmao = (pai->esquerda == filho) ? pai->direita : pai->esquerda;
+        int tamanhoPai = tamanhoFilho + tamanhoSubarvore(irmao) + 1;
+
+        if (tamanhoFilho > arvore->alfa * tamanhoPai)
+        {
+            struct NoArvore *novaSubarvore = rebalancearDSW(pai);
+            if (i == 0)
+                arvore->raiz = novaSubarvore;
+            else if (caminho[i - 1]->esquerda == pai)
+                caminho[i - 1]->esquerda = novaSubarvore;
+            else
+                caminho[i - 1]->direita = novaSubarvore;
+            return;
+        }
+        filho = pai;
+        tamanhoFilho = tamanhoPai;
+    }
+}
+
+// Função para buscar um valor (iterativa, não estoura a pilha em árvores degeneradas)
+struct NoArvore *buscar(struct NoArvore *raiz, int valor)
+{
+    while (raiz != NULL && raiz->dado != valor)
+    {
+        if (valor < raiz->dado)
+            raiz = raiz->esquerda;
+        else
+            raiz = raiz->direita;
+    }
+    return raiz;
+}
+
+// Função para excluir no modo bode expiatório
+// Reconstrói a árvore inteira quando ela encolhe abaixo de alfa * max_n
+void excluirBodeExpiatorio(struct ArvoreBodeExpiatorio *arvore, int valor)
+{
+    if (buscar(arvore->raiz, valor) == NULL)
+        return;
+
+    arvore->raiz = excluir(arvore->raiz, valor);
+    arvore->n--;
+    if (arvore->n < arvore->alfa * arvore->max_n)
+    {
+        arvore->raiz = rebalancearDSW(arvore->raiz);
+        arvore->max_n = arvore->n;
+    }
+}
+
 void percorrerEmOrdem(struct NoArvore *raiz)
 {
     if (raiz != NULL)
@@ -142,6 +386,160 @@ void mostraArvore(struct NoArvore *a, int b)
     mostraArvore(a->esquerda, b + 1);
 }
 
+// Acesso do snapshot (snapshot.h) aos nós desta árvore
+void *esquerdaSnapshot(const void *no)
+{
+    return ((const struct NoArvore *)no)->esquerda;
+}
+
+void *direitaSnapshot(const void *no)
+{
+    return ((const struct NoArvore *)no)->direita;
+}
+
+int32_t chaveSnapshot(const void *no)
+{
+    return ((const struct NoArvore *)no)->dado;
+}
+
+void *criarSnapshot(int32_t chave, uint8_t auxiliar)
+{
+    (void)auxiliar;
+    return criarNo(chave);
+}
+
+void ligarSnapshot(void *pai, void *filho, int direita)
+{
+    if (direita)
+        ((struct NoArvore *)pai)->direita = (struct NoArvore *)filho;
+    else
+        ((struct NoArvore *)pai)->esquerda = (struct NoArvore *)filho;
+}
+
+void liberarSnapshot(void *no)
+{
+    free(no);
+}
+
+static const AcessoSnapshot acessoSnapshot = {SNAPSHOT_BST, esquerdaSnapshot, direitaSnapshot, chaveSnapshot,
+                                              NULL, criarSnapshot, ligarSnapshot, liberarSnapshot};
+
+// Função para salvar a árvore em um snapshot binário; retorna os nós gravados ou -1
+long long salvarArvore(struct NoArvore *raiz, const char *caminho)
+{
+    return salvarSnapshot(raiz, caminho, &acessoSnapshot);
+}
+
+// Função para carregar uma árvore salva por salvarArvore, com a mesma forma
+struct NoArvore *carregarArvore(const char *caminho)
+{
+    return (struct NoArvore *)carregarSnapshot(caminho, &acessoSnapshot);
+}
+
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK BinaryTree.c -lm)
+// Com --bode-expiatorio como primeiro argumento mede o modo bode expiatório
+void *benchCriar(void)
+{
+    return calloc(1, sizeof(struct NoArvore *));
+}
+
+void benchInserir(void *estrutura, int chave)
+{
+    struct NoArvore **raiz = (struct NoArvore **)estrutura;
+    *raiz = inserir(*raiz, chave);
+}
+
+int benchBuscar(void *estrutura, int chave)
+{
+    return buscar(*(struct NoArvore **)estrutura, chave) != NULL;
+}
+
+void benchRemover(void *estrutura, int chave)
+{
+    struct NoArvore **raiz = (struct NoArvore **)estrutura;
+    *raiz = excluir(*raiz, chave);
+}
+
+int benchNiveis(struct NoArvore *raiz)
+{
+    if (raiz == NULL)
+        return 0;
+    int esquerda = benchNiveis(raiz->esquerda);
+    int direita = benchNiveis(raiz->direita);
+    return 1 + (esquerda > direita ? esquerda : direita);
+}
+
+int benchAltura(void *estrutura)
+{
+    return benchNiveis(*(struct NoArvore **)estrutura);
+}
+
+void *benchCriarBode(void)
+{
+    return criarArvoreBodeExpiatorio(0.7);
+}
+
+void benchInserirBode(void *estrutura, int chave)
+{
+    inserirBodeExpiatorio((struct ArvoreBodeExpiatorio *)estrutura, chave);
+}
+
+int benchBuscarBode(void *estrutura, int chave)
+{
+    return buscar(((struct ArvoreBodeExpiatorio *)estrutura)->raiz, chave) != NULL;
+}
+
+void benchRemoverBode(void *estrutura, int chave)
+{
+    excluirBodeExpiatorio((struct ArvoreBodeExpiatorio *)estrutura, chave);
+}
+
+int benchAlturaBode(void *estrutura)
+{
+    return benchNiveis(((struct ArvoreBodeExpiatorio *)estrutura)->raiz);
+}
+
+long long benchSalvar(void *estrutura, const char *caminho)
+{
+    return salvarArvore(*(struct NoArvore **)estrutura, caminho);
+}
+
+void *benchCarregar(const char *caminho)
+{
+    struct NoArvore **raiz = (struct NoArvore **)calloc(1, sizeof(struct NoArvore *));
+    *raiz = carregarArvore(caminho);
+    return raiz;
+}
+
+long long benchSalvarBode(void *estrutura, const char *caminho)
+{
+    return salvarArvore(((struct ArvoreBodeExpiatorio *)estrutura)->raiz, caminho);
+}
+
+void *benchCarregarBode(const char *caminho)
+{
+    // O snapshot aceita qualquer forma (até a de uma bst comum degenerada): adota com DSW
+    struct ArvoreBodeExpiatorio *arvore = criarArvoreBodeExpiatorio(0.7);
+    adotarArvore(arvore, carregarArvore(caminho));
+    return arvore;
+}
+
+int main(int argc, char *argv[])
+{
+    AdaptadorBench adaptador = {"bst", benchCriar, benchInserir, benchBuscar, benchRemover, benchAltura,
+                               benchSalvar, benchCarregar};
+    AdaptadorBench bode = {"bst_bode", benchCriarBode, benchInserirBode, benchBuscarBode, benchRemoverBode, benchAlturaBode,
+                           benchSalvarBode, benchCarregarBode};
+
+    if (argc > 1 && !strcmp(argv[1], "--bode-expiatorio"))
+    {
+        argv[1] = argv[0];
+        return executarBenchmark(&bode, argc - 1, argv + 1);
+    }
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main()
 {
     struct NoArvore *raiz = NULL;
@@ -161,6 +559,26 @@ int main()
     mostraArvore(raiz, 3);
     excluir(raiz,5);
     mostraArvore(raiz,3);
+
+    // Rebalanceamento sob demanda (Day-Stout-Warren)
+    printf("\nÁrvore após rebalancearDSW:\n");
+    raiz = rebalancearDSW(raiz);
+    mostraArvore(raiz, 3);
+
+    // Modo bode expiatório: a mesma entrada ordenada não degenera
+    struct ArvoreBodeExpiatorio *arvore = criarArvoreBodeExpiatorio(0.7);
+    for (int i = 1; i <= 10; i++)
+        inserirBodeExpiatorio(arvore, i);
+    printf("\nÁrvore bode expiatório com 1..10:\n");
+    mostraArvore(arvore->raiz, 3);
+
+    // Snapshot binário: salva e recarrega com a mesma forma
+    if (salvarArvore(arvore->raiz, "bst.snapshot") >= 0)
+    {
+        printf("\nÁrvore recarregada de bst.snapshot:\n");
+        mostraArvore(carregarArvore("bst.snapshot"), 3);
+        remove("bst.snapshot");
+    }
     /* Imprimindo a árvore em ordem
     printf("\nÁrvore em pré-ordem: ");
     percorrerPreOrdem(raiz);
@@ -176,3 +594,4 @@ int main()
 
     return 0;
 }
+#endif
@@ -1,5 +1,13 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include <math.h>
+#include <stdatomic.h>
+#include <pthread.h>  // MultiFila (compilar com -pthread)
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
 // Função para trocar dois elementos
 void trocar(int* a, int* b) {
@@ -8,30 +16,30 @@ void trocar(int* a, int* b) {
     *b = temp;
 }
 
+// Quando 1, as operações do heap não imprimem nada (para cargas grandes)
+int modoSilencioso = 0;
+
 // Função para "heapificar" um subárvore com raiz no nó 'i'
 // 'n' é o tamanho do heap
+// O valor da raiz fica guardado e um buraco desce pelo maior filho; cada nível
+// custa uma cópia em vez de uma troca, e o valor é escrito uma vez no final
 void heapificar(int vetor[], int n, int i) {
-    int maior = i;         // Inicialmente, a raiz é o maior
-    int esquerda = 2 * i + 1;  // Filho esquerdo de i
-    int direita = 2 * i + 2;   // Filho direito de i
-
-    // Se o filho esquerdo for maior que a raiz
-    if (esquerda < n && vetor[esquerda] > vetor[maior]) {
-        maior = esquerda;
-    }
-
-    // Se o filho direito for maior que o maior até agora
-    if (direita < n && vetor[direita] > vetor[maior]) {
-        maior = direita;
-    }
+    int valor = vetor[i];
 
-    // Se o maior não for a raiz
-    if (maior != i) {
-        trocar(&vetor[i], &vetor[maior]);
-
-        // Recursivamente heapificar o subárvore afetado
-        heapificar(vetor, n, maior);
+    while (2 * i + 1 < n) {
+        int maior = 2 * i + 1;  // Filho esquerdo de i
+        // Se o filho direito for maior que o esquerdo
+        if (maior + 1 < n && vetor[maior + 1] > vetor[maior]) {
+            maior++;
+        }
+        // Se nenhum filho for maior que o valor, o buraco é a posição dele
+        if (vetor[maior] <= valor) {
+            break;
+        }
+        vetor[i] = vetor[maior];  // O maior filho sobe para o buraco
+        i = maior;
     }
+    vetor[i] = valor;
 }
 
 // Função auxiliar para imprimir espaços
@@ -65,16 +73,28 @@ void inserirNoHeap(int vetor[], int n) {
 // Função para construir o Max-Heap inserindo um elemento de cada vez
 void construirMaxHeapIncremental(int vetor[], int tamanhoOriginal) {
     for (int i = 1; i <= tamanhoOriginal; i++) {
-        printf("\nInserindo elemento %d no heap:\n", vetor[i-1]);
+        if (!modoSilencioso)
+            printf("\nInserindo elemento %d no heap:\n", vetor[i-1]);
         inserirNoHeap(vetor, i);  // Inserir o i-ésimo elemento
-        imprimirArvore(vetor, i, 0, 0);  // Imprimir a árvore após a inserção
+        if (!modoSilencioso)
+            imprimirArvore(vetor, i, 0, 0);  // Imprimir a árvore após a inserção
+    }
+}
+
+// Função para construir o Max-Heap de baixo para cima (Floyd) em O(n)
+// Heapifica cada nó interno, do último ao primeiro; a maioria dos nós está
+// perto das folhas e desce poucos níveis, por isso o total é linear
+void construirMaxHeap(int vetor[], int n) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        heapificar(vetor, n, i);
     }
 }
 
 // Função para excluir a raiz (maior elemento) do Max-Heap
 int excluirDoHeap(int vetor[], int* n) {
     if (*n <= 0) {
-        printf("Heap vazio!\n");
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
         return -1;
     }
 
@@ -98,9 +118,67 @@ int excluirDoHeap(int vetor[], int* n) {
 void excluirElementosHeap(int vetor[], int* n) {
     while (*n > 0) {
         int removido = excluirDoHeap(vetor, n);
-        printf("\nElemento removido: %d\n", removido);
-        printf("Heap após remoção:\n");
-        imprimirArvore(vetor, *n, 0, 0);  // Imprimir o heap após cada remoção
+        if (!modoSilencioso) {
+            printf("\nElemento removido: %d\n", removido);
+            printf("Heap após remoção:\n");
+            imprimirArvore(vetor, *n, 0, 0);  // Imprimir o heap após cada remoção
+        }
+    }
+}
+
+// Função para excluir a raiz com a descida de baixo para cima (Wegener)
+// O buraco da raiz desce até uma folha seguindo sempre o maior filho (uma
+// comparação por nível, sem comparar com o último elemento), e então o último
+// elemento sobe a partir dessa folha. Como ele costuma ser pequeno, sobe pouco:
+// são ~log n comparações em vez das ~2 log n do heapificar
+int excluirDoHeapAscendente(int vetor[], int* n) {
+    if (*n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+
+    int raiz = vetor[0];
+    int ultimo = vetor[--(*n)];
+    int i = 0;
+
+    // Desce o buraco até uma folha
+    while (2 * i + 2 < *n) {
+        int maior = vetor[2 * i + 2] > vetor[2 * i + 1] ? 2 * i + 2 : 2 * i + 1;
+        vetor[i] = vetor[maior];
+        i = maior;
+    }
+    if (2 * i + 1 < *n) {  // Filho único no último nível
+        vetor[i] = vetor[2 * i + 1];
+        i = 2 * i + 1;
+    }
+
+    // Sobe o último elemento a partir do buraco
+    while (i > 0 && vetor[(i - 1) / 2] < ultimo) {
+        vetor[i] = vetor[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    if (*n > 0)
+        vetor[i] = ultimo;
+    return raiz;
+}
+
+// Função para ordenar o vetor em ordem crescente no próprio lugar (heapsort)
+// Cada exclusão libera a última posição do heap, que recebe o maior restante
+void heapSort(int vetor[], int n) {
+    construirMaxHeap(vetor, n);
+    while (n > 0) {
+        int maior = excluirDoHeap(vetor, &n);
+        vetor[n] = maior;
+    }
+}
+
+// Heapsort com a exclusão de baixo para cima
+void heapSortAscendente(int vetor[], int n) {
+    construirMaxHeap(vetor, n);
+    while (n > 0) {
+        int maior = excluirDoHeapAscendente(vetor, &n);
+        vetor[n] = maior;
     }
 }
 
@@ -112,7 +190,1211 @@ void imprimirVetor(int vetor[], int n) {
     printf("\n");
 }
 
+// ---------------------------------------------------------------------------
+// Heap d-ário com buraco (d fixo em tempo de compilação)
+// ---------------------------------------------------------------------------
+
+// Os filhos de i são ARIDADE*i+1 .. ARIDADE*i+ARIDADE. O vetor é deslocado para
+// que o elemento 1 comece numa linha de cache: cada grupo de irmãos (16 ou 32
+// bytes) fica inteiro numa única linha, e a altura cai para log_d(n).
+// Subir e descer movem um "buraco" em vez de trocar: cada nível custa uma
+// cópia, e o valor é escrito uma vez só no fim.
+// As posições de n até o fim da capacidade guardam INT_MIN, então o último
+// grupo de irmãos pode ser lido inteiro e a escolha do maior filho é um laço
+// de tamanho fixo, sem desvios, que o compilador desenrola.
+#ifndef ARIDADE
+#define ARIDADE 4  // Compile com -DARIDADE=8 para o heap 8-ário
+#endif
+#define LINHA_CACHE 64
+
+#if ARIDADE < 2 || (LINHA_CACHE / 4) % ARIDADE != 0
+#error "ARIDADE precisa ser 2, 4, 8 ou 16"
+#endif
+
+// Estrutura do heap d-ário
+typedef struct HeapDario {
+    int* vetor;       // Elementos; vetor + 1 é alinhado a uma linha de cache
+    void* bloco;      // Memória alocada
+    int n;            // Elementos no heap
+    int capacidade;   // Posições utilizáveis (múltiplo de ARIDADE, além da raiz)
+} HeapDario;
+
+// Função para (re)alocar o vetor alinhado, preservando os elementos
+void crescerHeapDario(HeapDario* heap, int capacidade) {
+    capacidade = (capacidade + ARIDADE - 1) / ARIDADE * ARIDADE + 1;
+    void* bloco = malloc(sizeof(int) * (size_t)capacidade + 2 * LINHA_CACHE);
+    if (bloco == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    // vetor + 1 alinhado: vetor fica 4 bytes antes de uma fronteira de linha
+    uintptr_t linha = ((uintptr_t)bloco + sizeof(int) + LINHA_CACHE - 1) & ~(uintptr_t)(LINHA_CACHE - 1);
+    int* vetor = (int*)linha - 1;
+    for (int i = 0; i < heap->n; i++)
+        vetor[i] = heap->vetor[i];
+    for (int i = heap->n; i < capacidade; i++)
+        vetor[i] = INT_MIN;
+
+    free(heap->bloco);
+    heap->bloco = bloco;
+    heap->vetor = vetor;
+    heap->capacidade = capacidade;
+}
+
+// Função para criar um heap d-ário vazio
+HeapDario* criarHeapDario(int capacidade) {
+    HeapDario* heap = (HeapDario*)calloc(1, sizeof(HeapDario));
+    if (heap == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    crescerHeapDario(heap, capacidade > 0 ? capacidade : ARIDADE);
+    return heap;
+}
+
+void liberarHeapDario(HeapDario* heap) {
+    free(heap->bloco);
+    free(heap);
+}
+
+// Função para escolher o maior entre os ARIDADE filhos que começam em 'primeiro'
+static inline int maiorFilho(const int vetor[], int primeiro) {
+    int maior = primeiro;
+    for (int j = 1; j < ARIDADE; j++)
+        maior = vetor[primeiro + j] > vetor[maior] ? primeiro + j : maior;
+    return maior;
+}
+
+// Função para subir o valor da posição i movendo o buraco para cima
+static inline void subirDario(int vetor[], int i) {
+    int valor = vetor[i];
+    while (i > 0) {
+        int pai = (i - 1) / ARIDADE;
+        if (vetor[pai] >= valor)
+            break;
+        vetor[i] = vetor[pai];  // O pai desce para o buraco
+        i = pai;
+    }
+    vetor[i] = valor;
+}
+
+// Função para descer o valor da posição i movendo o buraco para baixo
+static inline void descerDario(int vetor[], int n, int i) {
+    int valor = vetor[i];
+    for (;;) {
+        int primeiro = ARIDADE * i + 1;
+        if (primeiro >= n)
+            break;
+        int maior = maiorFilho(vetor, primeiro);
+        if (vetor[maior] <= valor)
+            break;
+        vetor[i] = vetor[maior];  // O maior filho sobe para o buraco
+        i = maior;
+    }
+    vetor[i] = valor;
+}
+
+// Função para inserir um elemento no heap d-ário
+void inserirHeapDario(HeapDario* heap, int valor) {
+    if (heap->n + ARIDADE >= heap->capacidade)  // Mantém o último grupo de irmãos dentro do vetor
+        crescerHeapDario(heap, heap->capacidade * 2);
+    heap->vetor[heap->n] = valor;
+    subirDario(heap->vetor, heap->n++);
+}
+
+// Função para excluir a raiz (maior elemento) do heap d-ário
+int excluirHeapDario(HeapDario* heap) {
+    if (heap->n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+
+    int raiz = heap->vetor[0];
+    heap->n--;
+    heap->vetor[0] = heap->vetor[heap->n];
+    heap->vetor[heap->n] = INT_MIN;  // A posição liberada volta a ser sentinela
+    if (heap->n > 0)
+        descerDario(heap->vetor, heap->n, 0);
+    return raiz;
+}
+
+// ---------------------------------------------------------------------------
+// Heap indexado: prioridades alteráveis por identificador (handle)
+// ---------------------------------------------------------------------------
+
+// Cada elemento tem um identificador fixo em 0..capacidade-1 (um vértice, uma
+// tarefa). O mapa de posições diz em que posição do heap cada identificador
+// está (-1 se ausente), então alterar ou remover um elemento não precisa
+// procurá-lo nem inserir duplicatas. O heap e o mapa ficam num único bloco.
+
+// Estrutura de uma entrada do heap: a prioridade anda junto com o identificador
+typedef struct EntradaHeap {
+    int prioridade;
+    int id;
+} EntradaHeap;
+
+// Estrutura do heap indexado
+typedef struct HeapIndexado {
+    EntradaHeap* itens;  // Heap binário de máximo
+    int* posicao;        // posicao[id] = índice em itens, ou -1
+    int n;
+    int capacidade;      // Identificadores válidos: 0..capacidade-1
+} HeapIndexado;
+
+// Função para criar um heap indexado para identificadores 0..capacidade-1
+HeapIndexado* criarHeapIndexado(int capacidade) {
+    HeapIndexado* heap = (HeapIndexado*)malloc(sizeof(HeapIndexado));
+    void* bloco = malloc((sizeof(EntradaHeap) + sizeof(int)) * (size_t)capacidade);
+    if (heap == NULL || bloco == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    heap->itens = (EntradaHeap*)bloco;
+    heap->posicao = (int*)(heap->itens + capacidade);
+    heap->n = 0;
+    heap->capacidade = capacidade;
+    for (int i = 0; i < capacidade; i++)
+        heap->posicao[i] = -1;
+    return heap;
+}
+
+void liberarHeapIndexado(HeapIndexado* heap) {
+    free(heap->itens);
+    free(heap);
+}
+
+// Função para verificar se o identificador está no heap: O(1)
+int contemHeapIndexado(const HeapIndexado* heap, int id) {
+    return id >= 0 && id < heap->capacidade && heap->posicao[id] >= 0;
+}
+
+// Função para subir a entrada da posição i (buraco), atualizando o mapa
+static void subirIndexado(HeapIndexado* heap, int i) {
+    EntradaHeap entrada = heap->itens[i];
+    while (i > 0 && heap->itens[(i - 1) / 2].prioridade < entrada.prioridade) {
+        heap->itens[i] = heap->itens[(i - 1) / 2];
+        heap->posicao[heap->itens[i].id] = i;
+        i = (i - 1) / 2;
+    }
+    heap->itens[i] = entrada;
+    heap->posicao[entrada.id] = i;
+}
+
+// Função para descer a entrada da posição i (buraco), atualizando o mapa
+static void descerIndexado(HeapIndexado* heap, int i) {
+    EntradaHeap entrada = heap->itens[i];
+    while (2 * i + 1 < heap->n) {
+        int maior = 2 * i + 1;
+        if (maior + 1 < heap->n && heap->itens[maior + 1].prioridade > heap->itens[maior].prioridade)
+            maior++;
+        if (heap->itens[maior].prioridade <= entrada.prioridade)
+            break;
+        heap->itens[i] = heap->itens[maior];
+        heap->posicao[heap->itens[i].id] = i;
+        i = maior;
+    }
+    heap->itens[i] = entrada;
+    heap->posicao[entrada.id] = i;
+}
+
+// Função para mudar a prioridade de um identificador presente: O(log n)
+// Sobe se aumentou e desce se diminuiu
+void alterarPrioridade(HeapIndexado* heap, int id, int prioridade) {
+    if (!contemHeapIndexado(heap, id)) {
+        printf("Erro: Identificador %d fora do heap.\n", id);
+        exit(-1);
+    }
+    int i = heap->posicao[id];
+    int antiga = heap->itens[i].prioridade;
+    heap->itens[i].prioridade = prioridade;
+    if (prioridade > antiga)
+        subirIndexado(heap, i);
+    else if (prioridade < antiga)
+        descerIndexado(heap, i);
+}
+
+// Função para inserir um identificador; se já estiver no heap, só altera a prioridade
+void inserirHeapIndexado(HeapIndexado* heap, int id, int prioridade) {
+    if (id < 0 || id >= heap->capacidade) {
+        printf("Erro: Identificador %d inválido.\n", id);
+        exit(-1);
+    }
+    if (heap->posicao[id] >= 0) {
+        alterarPrioridade(heap, id, prioridade);
+        return;
+    }
+    heap->itens[heap->n].prioridade = prioridade;
+    heap->itens[heap->n].id = id;
+    subirIndexado(heap, heap->n++);
+}
+
+// Função para remover um identificador qualquer do heap: O(log n)
+// A última entrada ocupa o lugar dele e sobe ou desce conforme a prioridade
+void removerHeapIndexado(HeapIndexado* heap, int id) {
+    if (!contemHeapIndexado(heap, id))
+        return;
+    int i = heap->posicao[id];
+    heap->posicao[id] = -1;
+    heap->n--;
+    if (i == heap->n)
+        return;
+
+    heap->itens[i] = heap->itens[heap->n];
+    if (i > 0 && heap->itens[(i - 1) / 2].prioridade < heap->itens[i].prioridade)
+        subirIndexado(heap, i);
+    else
+        descerIndexado(heap, i);
+}
+
+// Função para excluir o elemento de maior prioridade; retorna o identificador (-1 se vazio)
+int excluirMaximoIndexado(HeapIndexado* heap, int* prioridade) {
+    if (heap->n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+    int id = heap->itens[0].id;
+    if (prioridade != NULL)
+        *prioridade = heap->itens[0].prioridade;
+    removerHeapIndexado(heap, id);
+    return id;
+}
+
+// ---------------------------------------------------------------------------
+// MultiFila: fila de prioridade concorrente relaxada
+// ---------------------------------------------------------------------------
+
+// São c·p heaps d-ários, cada um com a sua trava. Inserir escolhe uma fila ao
+// acaso; remover sorteia duas filas, compara os topos (lidos sem trava) e tira
+// o maior dos dois. Nenhuma trava é global, então p threads raramente disputam
+// a mesma fila; quando trylock falha, a thread sorteia de novo em vez de esperar.
+//
+// A ordem é relaxada: o elemento removido não é necessariamente o máximo. Com
+// a escolha entre duas filas, o posto esperado do elemento removido (quantos
+// maiores ainda estão na estrutura) é O(numFilas), e O(numFilas·log numFilas)
+// com alta probabilidade (Rihani, Sanders e Dementiev; Alistarh et al.).
+// Com c = 2 isso é da ordem de 2p; o benchmark mede o posto real.
+// As chaves precisam ser maiores que INT_MIN, que marca uma fila vazia.
+
+// Estrutura de uma fila da MultiFila (uma linha de cache por fila)
+typedef struct FilaTravada {
+    pthread_mutex_t trava;
+    atomic_int topo;   // Cópia do máximo do heap (INT_MIN se vazio) para leitura sem trava
+    HeapDario* heap;
+} __attribute__((aligned(LINHA_CACHE))) FilaTravada;
+
+// Estrutura da MultiFila
+typedef struct MultiFila {
+    FilaTravada* filas;
+    void* bloco;
+    int numFilas;
+} MultiFila;
+
+// Função para criar a MultiFila com c filas por thread
+MultiFila* criarMultiFila(int numThreads, int c) {
+    int numFilas = numThreads * c < 2 ? 2 : numThreads * c;
+    MultiFila* mf = (MultiFila*)malloc(sizeof(MultiFila));
+    void* bloco = malloc(sizeof(FilaTravada) * (size_t)numFilas + LINHA_CACHE);
+    if (mf == NULL || bloco == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    mf->numFilas = numFilas;
+    mf->bloco = bloco;
+    mf->filas = (FilaTravada*)(((uintptr_t)mf->bloco + LINHA_CACHE - 1) & ~(uintptr_t)(LINHA_CACHE - 1));
+    for (int i = 0; i < mf->numFilas; i++) {
+        pthread_mutex_init(&mf->filas[i].trava, NULL);
+        atomic_init(&mf->filas[i].topo, INT_MIN);
+        mf->filas[i].heap = criarHeapDario(1024);
+    }
+    return mf;
+}
+
+void liberarMultiFila(MultiFila* mf) {
+    for (int i = 0; i < mf->numFilas; i++) {
+        pthread_mutex_destroy(&mf->filas[i].trava);
+        liberarHeapDario(mf->filas[i].heap);
+    }
+    free(mf->bloco);
+    free(mf);
+}
+
+// Gerador xorshift por thread (o estado é do chamador, então não há disputa)
+static inline uint32_t sortearFila(uint64_t* semente, int numFilas) {
+    uint64_t x = *semente;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *semente = x;
+    return (uint32_t)(((x >> 32) * (uint64_t)numFilas) >> 32);
+}
+
+// Função para inserir numa fila sorteada
+void inserirMultiFila(MultiFila* mf, int valor, uint64_t* semente) {
+    FilaTravada* fila;
+    do {
+        fila = &mf->filas[sortearFila(semente, mf->numFilas)];
+    } while (pthread_mutex_trylock(&fila->trava) != 0);
+
+    inserirHeapDario(fila->heap, valor);
+    atomic_store_explicit(&fila->topo, fila->heap->vetor[0], memory_order_relaxed);
+    pthread_mutex_unlock(&fila->trava);
+}
+
+// Função para remover o maior topo entre duas filas sorteadas
+// Retorna 0 se todas as filas estavam vazias quando foram verificadas
+int excluirMultiFila(MultiFila* mf, int* valor, uint64_t* semente) {
+    for (;;) {
+        FilaTravada* a = &mf->filas[sortearFila(semente, mf->numFilas)];
+        FilaTravada* b = &mf->filas[sortearFila(semente, mf->numFilas)];
+        int topoA = atomic_load_explicit(&a->topo, memory_order_relaxed);
+        int topoB = atomic_load_explicit(&b->topo, memory_order_relaxed);
+        FilaTravada* fila = topoA >= topoB ? a : b;
+
+        if ((topoA > topoB ? topoA : topoB) == INT_MIN) {
+            // As duas sorteadas estão vazias: confere todas antes de desistir
+            int alguma = 0;
+            for (int i = 0; i < mf->numFilas && !alguma; i++)
+                alguma = atomic_load_explicit(&mf->filas[i].topo, memory_order_relaxed) != INT_MIN;
+            if (!alguma)
+                return 0;
+            continue;
+        }
+        if (pthread_mutex_trylock(&fila->trava) != 0)
+            continue;  // Disputada: sorteia outro par
+        if (fila->heap->n == 0) {  // Esvaziada entre a leitura do topo e a trava
+            pthread_mutex_unlock(&fila->trava);
+            continue;
+        }
+
+        *valor = excluirHeapDario(fila->heap);
+        atomic_store_explicit(&fila->topo, fila->heap->n > 0 ? fila->heap->vetor[0] : INT_MIN,
+                              memory_order_relaxed);
+        pthread_mutex_unlock(&fila->trava);
+        return 1;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Top-k em fluxo: os k maiores valores de uma entrada sem tamanho conhecido
+// ---------------------------------------------------------------------------
+
+// Guarda os k maiores vistos até agora num heap de MÍNIMO de tamanho k: a raiz
+// é o limiar, o menor dos candidatos. Um valor que não supera a raiz é
+// descartado com uma comparação; os demais substituem a raiz e descem.
+// Em fluxos longos quase tudo é descartado, então os lotes são varridos em
+// blocos de TOPK_BLOCO comparando contra o limiar num laço sem desvios que o
+// compilador vetoriza; só blocos com algum candidato passam pelo heap.
+#define TOPK_BLOCO 16
+
+// Estrutura do top-k
+typedef struct TopK {
+    int* vetor;  // Heap de mínimo com os candidatos
+    int n;       // Candidatos guardados (até k)
+    int k;
+} TopK;
+
+// Função para criar um top-k vazio
+TopK* criarTopK(int k) {
+    TopK* topk = (TopK*)malloc(sizeof(TopK));
+    if (topk == NULL || k < 1) {
+        printf("Erro: k inválido ou falha na alocação de memória.\n");
+        exit(-1);
+    }
+    topk->vetor = (int*)malloc(sizeof(int) * (size_t)k);
+    if (topk->vetor == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    topk->n = 0;
+    topk->k = k;
+    return topk;
+}
+
+void liberarTopK(TopK* topk) {
+    free(topk->vetor);
+    free(topk);
+}
+
+// Função para descer o valor da posição i no heap de mínimo (buraco)
+static inline void descerMinimo(int vetor[], int n, int i) {
+    int valor = vetor[i];
+    while (2 * i + 1 < n) {
+        int menor = 2 * i + 1;
+        if (menor + 1 < n && vetor[menor + 1] < vetor[menor])
+            menor++;
+        if (vetor[menor] >= valor)
+            break;
+        vetor[i] = vetor[menor];
+        i = menor;
+    }
+    vetor[i] = valor;
+}
+
+// Função para oferecer um valor ao top-k
+static inline void oferecerTopK(TopK* topk, int valor) {
+    if (topk->n < topk->k) {
+        // Ainda não encheu: insere subindo no heap de mínimo
+        int i = topk->n++;
+        while (i > 0 && topk->vetor[(i - 1) / 2] > valor) {
+            topk->vetor[i] = topk->vetor[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        topk->vetor[i] = valor;
+    } else if (valor > topk->vetor[0]) {
+        // Supera o limiar: substitui o menor candidato
+        topk->vetor[0] = valor;
+        descerMinimo(topk->vetor, topk->n, 0);
+    }
+}
+
+// Função para oferecer um lote de valores com pré-filtro pelo limiar
+void oferecerLoteTopK(TopK* topk, const int lote[], size_t n) {
+    size_t i = 0;
+    while (i < n && topk->n < topk->k)
+        oferecerTopK(topk, lote[i++]);
+
+    for (; i + TOPK_BLOCO <= n; i += TOPK_BLOCO) {
+        int limiar = topk->vetor[0];
+        int algum = 0;
+        for (int j = 0; j < TOPK_BLOCO; j++)  // Sem desvios: vira comparações vetoriais
+            algum |= lote[i + j] > limiar;
+        if (algum) {
+            for (int j = 0; j < TOPK_BLOCO; j++)
+                oferecerTopK(topk, lote[i + j]);
+        }
+    }
+    for (; i < n; i++)
+        oferecerTopK(topk, lote[i]);
+}
+
+// Função para juntar os candidatos de 'origem' em 'destino'
+void mesclarTopK(TopK* destino, const TopK* origem) {
+    oferecerLoteTopK(destino, origem->vetor, origem->n);
+}
+
+// Função para extrair os candidatos em ordem decrescente; retorna quantos
+// O top-k fica vazio: o heap de mínimo é ordenado no próprio vetor (heapsort)
+int extrairTopK(TopK* topk, int saida[]) {
+    int total = topk->n;
+    while (topk->n > 0) {
+        int menor = topk->vetor[0];
+        topk->vetor[0] = topk->vetor[--topk->n];
+        descerMinimo(topk->vetor, topk->n, 0);
+        saida[topk->n] = menor;  // O menor restante vai para o fim
+    }
+    return total;
+}
+
+// Contexto de uma thread do top-k paralelo
+typedef struct TrabalhoTopK {
+    const int* dados;
+    size_t n;
+    TopK* topk;
+    int emThread;  // 1 se o pedaço foi para uma thread que precisa de join
+} TrabalhoTopK;
+
+void* threadTopK(void* arg) {
+    TrabalhoTopK* t = (TrabalhoTopK*)arg;
+    oferecerLoteTopK(t->topk, t->dados, t->n);
+    return NULL;
+}
+
+// Função para calcular o top-k de um vetor com várias threads
+// Cada thread calcula o top-k parcial do seu pedaço; os parciais são mesclados
+// no da primeira thread, e a saída (até k valores) sai em ordem decrescente
+int topKParalelo(const int dados[], size_t n, int k, int numThreads, int saida[]) {
+    if (numThreads < 1)
+        numThreads = 1;
+    pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * numThreads);
+    TrabalhoTopK* trabalhos = (TrabalhoTopK*)malloc(sizeof(TrabalhoTopK) * numThreads);
+    if (ids == NULL || trabalhos == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    size_t pedaco = (n + numThreads - 1) / numThreads;
+    for (int i = 0; i < numThreads; i++) {
+        size_t inicio = pedaco * i < n ? pedaco * i : n;
+        size_t fim = inicio + pedaco < n ? inicio + pedaco : n;
+        trabalhos[i].dados = dados + inicio;
+        trabalhos[i].n = fim - inicio;
+        trabalhos[i].topk = criarTopK(k);
+        trabalhos[i].emThread = i > 0 && pthread_create(&ids[i], NULL, threadTopK, &trabalhos[i]) == 0;
+    }
+    // A thread principal faz o primeiro pedaço e os que ficaram sem thread
+    for (int i = 0; i < numThreads; i++) {
+        if (!trabalhos[i].emThread)
+            threadTopK(&trabalhos[i]);
+    }
+
+    for (int i = 1; i < numThreads; i++) {
+        if (trabalhos[i].emThread)
+            pthread_join(ids[i], NULL);
+        mesclarTopK(trabalhos[0].topk, trabalhos[i].topk);
+        liberarTopK(trabalhos[i].topk);
+    }
+    int total = extrairTopK(trabalhos[0].topk, saida);
+    liberarTopK(trabalhos[0].topk);
+    free(trabalhos);
+    free(ids);
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+// Heap min-max: mínimo e máximo no mesmo vetor
+// ---------------------------------------------------------------------------
+
+// Os níveis alternam: o nível 0 (a raiz) e os pares são de mínimo, os ímpares
+// de máximo. Um nó de nível de mínimo é menor que todos os seus descendentes e
+// um de nível de máximo é maior, então o mínimo é vetor[0] e o máximo é o maior
+// filho da raiz. Subir compara com o pai uma vez e depois pula de avô em avô;
+// descer olha filhos e netos (até 6 posições, 4 delas contíguas nos netos).
+// Usa o mesmo vetor e contador que inserirNoHeap/excluirDoHeap.
+
+// Função para saber se a posição i está num nível de máximo
+static inline int nivelDeMaximo(int i) {
+    return (31 - __builtin_clz((unsigned)i + 1)) & 1;
+}
+
+// Compara a e b na ordem do nível: 'maximo' = 1 quer o maior, 0 o menor
+static inline int vemAntes(int a, int b, int maximo) {
+    return maximo ? a > b : a < b;
+}
+
+// Função para subir 'valor' a partir do buraco i, de avô em avô, nos níveis do mesmo tipo
+static inline void subirAvos(int vetor[], int i, int valor, int maximo) {
+    while (i >= 3 && vemAntes(valor, vetor[(i - 3) / 4], maximo)) {
+        vetor[i] = vetor[(i - 3) / 4];
+        i = (i - 3) / 4;
+    }
+    vetor[i] = valor;
+}
+
+// Função para descer 'valor' a partir do buraco i (nível do tipo 'maximo')
+// Procura o mais extremo entre filhos e netos. Se for um neto e vencer o valor,
+// sobe para o buraco; o valor continua a descer de lá, mas antes troca com o
+// pai do neto se violar a ordem do nível oposto
+static inline void descerMinMax(int vetor[], int n, int i, int valor, int maximo) {
+    while (2 * i + 1 < n) {
+        int extremo = 2 * i + 1;
+        if (extremo + 1 < n && vemAntes(vetor[extremo + 1], vetor[extremo], maximo))
+            extremo++;
+        int neto = 4 * i + 3;
+        int ultimoNeto = neto + 4 < n ? neto + 4 : n;
+        for (int j = neto; j < ultimoNeto; j++) {
+            if (vemAntes(vetor[j], vetor[extremo], maximo))
+                extremo = j;
+        }
+
+        if (!vemAntes(vetor[extremo], valor, maximo))
+            break;
+        vetor[i] = vetor[extremo];
+        i = extremo;
+        if (extremo < neto)
+            break;  // Era um filho: não tem netos abaixo dele para violar
+        int pai = (extremo - 1) / 2;
+        if (vemAntes(vetor[pai], valor, maximo)) {
+            int temp = vetor[pai];
+            vetor[pai] = valor;
+            valor = temp;
+        }
+    }
+    vetor[i] = valor;
+}
+
+// Função para inserir 'valor' no fim do heap min-max (o vetor precisa ter espaço)
+void inserirMinMax(int vetor[], int* n, int valor) {
+    int i = (*n)++;
+    if (i == 0) {
+        vetor[0] = valor;
+        return;
+    }
+    int pai = (i - 1) / 2;
+    // Se violar a ordem do pai (nível oposto), o pai desce e o valor segue pelos avós dele
+    if (nivelDeMaximo(i)) {
+        if (valor < vetor[pai]) {
+            vetor[i] = vetor[pai];
+            subirAvos(vetor, pai, valor, 0);
+        } else {
+            subirAvos(vetor, i, valor, 1);
+        }
+    } else {
+        if (valor > vetor[pai]) {
+            vetor[i] = vetor[pai];
+            subirAvos(vetor, pai, valor, 1);
+        } else {
+            subirAvos(vetor, i, valor, 0);
+        }
+    }
+}
+
+// Posição do máximo: a raiz se estiver sozinha, senão o maior dos seus filhos
+static inline int posicaoMaximo(const int vetor[], int n) {
+    if (n <= 2)
+        return n - 1;
+    return vetor[1] >= vetor[2] ? 1 : 2;
+}
+
+int minimoMinMax(const int vetor[], int n) {
+    if (n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+    return vetor[0];
+}
+
+int maximoMinMax(const int vetor[], int n) {
+    if (n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+    return vetor[posicaoMaximo(vetor, n)];
+}
+
+// Função para excluir uma posição de extremo e refazer o heap
+// 'maximo' é constante em cada chamada (a raiz é de mínimo, seus filhos de
+// máximo), então o compilador gera uma descida sem testar o tipo do nível
+static inline int excluirPosicaoMinMax(int vetor[], int* n, int i, int maximo) {
+    int removido = vetor[i];
+    int ultimo = vetor[--(*n)];
+    if (i < *n)
+        descerMinMax(vetor, *n, i, ultimo, maximo);
+    return removido;
+}
+
+// Função para excluir o menor elemento
+int excluirMinimoMinMax(int vetor[], int* n) {
+    if (*n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+    return excluirPosicaoMinMax(vetor, n, 0, 0);
+}
+
+// Função para excluir o maior elemento
+int excluirMaximoMinMax(int vetor[], int* n) {
+    if (*n <= 0) {
+        if (!modoSilencioso)
+            printf("Heap vazio!\n");
+        return -1;
+    }
+    return excluirPosicaoMinMax(vetor, n, posicaoMaximo(vetor, *n), 1);
+}
+
 // Função principal
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK HeapMax.c -lm)
+// Buscar consulta o topo e remover exclui a raiz (a chave sorteada é ignorada)
+typedef struct HeapBench {
+    int* vetor;
+    int n;
+    int capacidade;
+} HeapBench;
+
+void* benchCriar(void) {
+    return calloc(1, sizeof(HeapBench));
+}
+
+void benchInserir(void* estrutura, int chave) {
+    HeapBench* heap = (HeapBench*)estrutura;
+    if (heap->n == heap->capacidade) {
+        heap->capacidade = heap->capacidade ? heap->capacidade * 2 : 1024;
+        heap->vetor = (int*)realloc(heap->vetor, sizeof(int) * heap->capacidade);
+    }
+    heap->vetor[heap->n++] = chave;
+    inserirNoHeap(heap->vetor, heap->n);
+}
+
+int benchBuscar(void* estrutura, int chave) {
+    HeapBench* heap = (HeapBench*)estrutura;
+    return heap->n > 0 && heap->vetor[0] >= chave;
+}
+
+void benchRemover(void* estrutura, int chave) {
+    HeapBench* heap = (HeapBench*)estrutura;
+    (void)chave;
+    if (heap->n > 0)
+        excluirDoHeap(heap->vetor, &heap->n);
+}
+
+int benchAltura(void* estrutura) {
+    HeapBench* heap = (HeapBench*)estrutura;
+    return heap->n > 0 ? (int)log2(heap->n) + 1 : 0;
+}
+
+// Adaptador do heap d-ário (--dario como primeiro argumento)
+void* benchCriarDario(void) {
+    return criarHeapDario(1024);
+}
+
+void benchInserirDario(void* estrutura, int chave) {
+    inserirHeapDario((HeapDario*)estrutura, chave);
+}
+
+int benchBuscarDario(void* estrutura, int chave) {
+    HeapDario* heap = (HeapDario*)estrutura;
+    return heap->n > 0 && heap->vetor[0] >= chave;
+}
+
+void benchRemoverDario(void* estrutura, int chave) {
+    HeapDario* heap = (HeapDario*)estrutura;
+    (void)chave;
+    if (heap->n > 0)
+        excluirHeapDario(heap);
+}
+
+int benchAlturaDario(void* estrutura) {
+    HeapDario* heap = (HeapDario*)estrutura;
+    int altura = 0;
+    for (long nivel = 1, total = 0; total < heap->n; nivel *= ARIDADE, altura++)
+        total += nivel;
+    return altura;
+}
+
+// Vazão de push e pop (--push-pop [n]): n inserções aleatórias seguidas de n remoções,
+// no heap binário original e no d-ário
+int benchmarkPushPop(int n) {
+    int* chaves = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++)
+        chaves[i] = (int)(benchAleatorio() & 0x7fffffff);
+
+    printf("variante,n,ns_push,ns_pop,soma\n");
+
+    int* vetor = (int*)malloc(sizeof(int) * n);
+    int tamanho = 0;
+    long long soma = 0;
+    uint64_t inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++) {
+        vetor[tamanho++] = chaves[i];
+        inserirNoHeap(vetor, tamanho);
+    }
+    uint64_t meio = benchAgoraNs();
+    while (tamanho > 0)
+        soma += excluirDoHeap(vetor, &tamanho);
+    uint64_t fim = benchAgoraNs();
+    printf("binario,%d,%.1f,%.1f,%lld\n", n, (double)(meio - inicio) / n, (double)(fim - meio) / n, soma);
+    free(vetor);
+
+    HeapDario* heap = criarHeapDario(1024);
+    soma = 0;
+    inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++)
+        inserirHeapDario(heap, chaves[i]);
+    meio = benchAgoraNs();
+    while (heap->n > 0)
+        soma += excluirHeapDario(heap);
+    fim = benchAgoraNs();
+    printf("dario_%d,%d,%.1f,%.1f,%lld\n", ARIDADE, n, (double)(meio - inicio) / n, (double)(fim - meio) / n, soma);
+    liberarHeapDario(heap);
+
+    free(chaves);
+    return 0;
+}
+
+int compararInt(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Construção e ordenação (--ordenacao [n]): construção incremental contra Floyd,
+// e heapsort (com as duas exclusões) contra o qsort da biblioteca padrão
+int benchmarkOrdenacao(int n) {
+    int* original = (int*)malloc(sizeof(int) * n);
+    int* vetor = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++)
+        original[i] = (int)(benchAleatorio() & 0x7fffffff);
+
+    modoSilencioso = 1;
+    printf("variante,n,segundos,ns_por_elemento,ok\n");
+
+    const char* nomes[] = {"construcao_incremental", "construcao_floyd", "heapsort",
+                           "heapsort_ascendente", "qsort"};
+    for (int v = 0; v < 5; v++) {
+        memcpy(vetor, original, sizeof(int) * n);
+        uint64_t inicio = benchAgoraNs();
+        switch (v) {
+            case 0: construirMaxHeapIncremental(vetor, n); break;
+            case 1: construirMaxHeap(vetor, n); break;
+            case 2: heapSort(vetor, n); break;
+            case 3: heapSortAscendente(vetor, n); break;
+            default: qsort(vetor, n, sizeof(int), compararInt); break;
+        }
+        uint64_t fim = benchAgoraNs();
+
+        // Confere a propriedade de heap (construção) ou a ordem (ordenação)
+        int ok = 1;
+        for (int i = 1; i < n && ok; i++)
+            ok = v < 2 ? vetor[(i - 1) / 2] >= vetor[i] : vetor[i - 1] <= vetor[i];
+        printf("%s,%d,%.4f,%.1f,%d\n", nomes[v], n, (fim - inicio) / 1e9, (double)(fim - inicio) / n, ok);
+    }
+
+    free(vetor);
+    free(original);
+    return 0;
+}
+
+// Chave de 64 bits do heap preguiçoso: prioridade nos bits altos, identificador nos baixos
+static inline long long chavePreguicosa(int prioridade, int id) {
+    return ((long long)prioridade << 32) | (unsigned)id;
+}
+
+// Alterações de prioridade (--indexado [n]): n identificadores e 4n alterações
+// aleatórias, seguidas do esvaziamento. Compara o heap indexado com o heap
+// "preguiçoso", que insere duplicatas e descarta as entradas velhas ao sair
+int benchmarkIndexado(int n) {
+    long long alteracoes = 4LL * n;
+    uint64_t semente = bench_estado;
+    int* atual = (int*)malloc(sizeof(int) * n);
+    long long soma = 0;
+
+    printf("variante,n,alteracoes,segundos,pico_entradas,bytes_pico,soma\n");
+
+    // Heap indexado
+    HeapIndexado* heap = criarHeapIndexado(n);
+    uint64_t inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++)
+        inserirHeapIndexado(heap, i, (int)(benchAleatorio() & 0x3fffffff));
+    for (long long k = 0; k < alteracoes; k++) {
+        int id = (int)(benchAleatorio() % n);
+        alterarPrioridade(heap, id, (int)(benchAleatorio() & 0x3fffffff));
+    }
+    int prioridade;
+    while (heap->n > 0) {
+        excluirMaximoIndexado(heap, &prioridade);
+        soma += prioridade;
+    }
+    printf("indexado,%d,%lld,%.3f,%d,%zu,%lld\n", n, alteracoes, (benchAgoraNs() - inicio) / 1e9, n,
+           (sizeof(EntradaHeap) + sizeof(int)) * (size_t)n, soma);
+    liberarHeapIndexado(heap);
+
+    // Heap preguiçoso: cada alteração é uma nova entrada; 'atual' guarda a prioridade válida
+    bench_estado = semente;  // Mesma sequência de alterações
+    long long capacidade = n + alteracoes, tamanho = 0, pico = 0;
+    long long* itens = (long long*)malloc(sizeof(long long) * capacidade);
+    soma = 0;
+    inicio = benchAgoraNs();
+    for (long long k = 0; k < n + alteracoes; k++) {
+        int id = k < n ? (int)k : (int)(benchAleatorio() % n);
+        atual[id] = (int)(benchAleatorio() & 0x3fffffff);
+        long long chave = chavePreguicosa(atual[id], id);
+        long long i = tamanho++;
+        while (i > 0 && itens[(i - 1) / 2] < chave) {
+            itens[i] = itens[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        itens[i] = chave;
+        if (tamanho > pico)
+            pico = tamanho;
+    }
+    while (tamanho > 0) {
+        long long topo = itens[0], ultimo = itens[--tamanho], i = 0;
+        while (2 * i + 1 < tamanho) {
+            long long maior = 2 * i + 1;
+            if (maior + 1 < tamanho && itens[maior + 1] > itens[maior])
+                maior++;
+            if (itens[maior] <= ultimo)
+                break;
+            itens[i] = itens[maior];
+            i = maior;
+        }
+        itens[i] = ultimo;
+        int id = (int)(topo & 0xffffffff);
+        if ((int)(topo >> 32) == atual[id]) {  // Entrada válida: a primeira que sai de cada id
+            soma += atual[id];
+            atual[id] = -1;
+        }
+    }
+    printf("preguicoso,%d,%lld,%.3f,%lld,%zu,%lld\n", n, alteracoes, (benchAgoraNs() - inicio) / 1e9, pico,
+           sizeof(long long) * (size_t)pico, soma);
+
+    free(itens);
+    free(atual);
+    return 0;
+}
+
+// Heap original protegido por uma única trava (referência da disputa)
+typedef struct HeapTravado {
+    pthread_mutex_t trava;
+    HeapBench heap;
+} HeapTravado;
+
+void inserirHeapTravado(HeapTravado* h, int valor) {
+    pthread_mutex_lock(&h->trava);
+    benchInserir(&h->heap, valor);
+    pthread_mutex_unlock(&h->trava);
+}
+
+int excluirHeapTravado(HeapTravado* h, int* valor) {
+    pthread_mutex_lock(&h->trava);
+    int havia = h->heap.n > 0;
+    if (havia)
+        *valor = excluirDoHeap(h->heap.vetor, &h->heap.n);
+    pthread_mutex_unlock(&h->trava);
+    return havia;
+}
+
+// Contexto de uma thread do benchmark de disputa
+typedef struct TrabalhoDisputa {
+    MultiFila* mf;        // NULL: usa o heap travado
+    HeapTravado* travado;
+    long long operacoes;
+    uint64_t semente;
+    long long soma;
+} TrabalhoDisputa;
+
+// Cada thread alterna inserção e remoção (a estrutura mantém o tamanho inicial)
+void* threadDisputa(void* arg) {
+    TrabalhoDisputa* t = (TrabalhoDisputa*)arg;
+    int valor;
+    for (long long k = 0; k < t->operacoes; k++) {
+        t->semente ^= t->semente << 13;
+        t->semente ^= t->semente >> 7;
+        t->semente ^= t->semente << 17;
+        int chave = (int)(t->semente & 0x3fffffff);
+        if (t->mf != NULL) {
+            inserirMultiFila(t->mf, chave, &t->semente);
+            if (excluirMultiFila(t->mf, &valor, &t->semente))
+                t->soma += valor;
+        } else {
+            inserirHeapTravado(t->travado, chave);
+            if (excluirHeapTravado(t->travado, &valor))
+                t->soma += valor;
+        }
+    }
+    return NULL;
+}
+
+// Árvore de Fenwick para contar quantas chaves restantes são maiores (posto)
+static void somarFenwick(int* arvore, int n, int i, int delta) {
+    for (i++; i <= n; i += i & -i)
+        arvore[i] += delta;
+}
+
+static int prefixoFenwick(const int* arvore, int i) {  // Quantidade de chaves < i
+    int total = 0;
+    for (; i > 0; i -= i & -i)
+        total += arvore[i];
+    return total;
+}
+
+// Disputa (--multifila [ops_por_thread] [c]): vazão com 1, 2, 4, ... threads até o
+// número de núcleos, da MultiFila e do heap travado; depois o erro de posto da
+// MultiFila, esvaziando-a numa thread e comparando cada remoção com o máximo real
+int benchmarkMultiFila(long long operacoes, int c) {
+    int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int inicial = 1000000;
+
+    printf("variante,threads,filas,operacoes,mops_s\n");
+    for (int threads = 1;; threads = threads * 2 > nucleos && threads < nucleos ? nucleos : threads * 2) {
+        for (int variante = 0; variante < 2; variante++) {
+            MultiFila* mf = variante == 0 ? criarMultiFila(threads, c) : NULL;
+            HeapTravado travado;
+            pthread_mutex_init(&travado.trava, NULL);
+            memset(&travado.heap, 0, sizeof(travado.heap));
+
+            uint64_t semente = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < inicial; i++) {
+                int chave = (int)(benchAleatorio() & 0x3fffffff);
+                if (mf != NULL)
+                    inserirMultiFila(mf, chave, &semente);
+                else
+                    inserirHeapTravado(&travado, chave);
+            }
+
+            pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+            TrabalhoDisputa* trabalhos = (TrabalhoDisputa*)calloc(threads, sizeof(TrabalhoDisputa));
+            uint64_t inicio = benchAgoraNs();
+            for (int i = 0; i < threads; i++) {
+                trabalhos[i].mf = mf;
+                trabalhos[i].travado = &travado;
+                trabalhos[i].operacoes = operacoes;
+                trabalhos[i].semente = 0x2545f4914f6cdd1dULL * (i + 1);
+                pthread_create(&ids[i], NULL, threadDisputa, &trabalhos[i]);
+            }
+            for (int i = 0; i < threads; i++)
+                pthread_join(ids[i], NULL);
+            double segundos = (benchAgoraNs() - inicio) / 1e9;
+
+            printf("%s,%d,%d,%lld,%.2f\n", mf != NULL ? "multifila" : "heap_travado", threads,
+                   mf != NULL ? mf->numFilas : 1, 2 * operacoes * threads, 2 * operacoes * threads / segundos / 1e6);
+
+            free(trabalhos);
+            free(ids);
+            if (mf != NULL)
+                liberarMultiFila(mf);
+            free(travado.heap.vetor);
+            pthread_mutex_destroy(&travado.trava);
+        }
+        if (threads >= nucleos)
+            break;
+    }
+
+    // Erro de posto: chaves 0..n-1 distintas, esvaziadas em ordem relaxada
+    printf("\nfilas,n,posto_medio,posto_maximo\n");
+    for (int filas = 2; filas <= 64; filas *= 2) {
+        int n = 1 << 20;
+        MultiFila* mf = criarMultiFila(filas, 1);
+        int* fenwick = (int*)calloc(n + 1, sizeof(int));
+        uint64_t semente = 0x9e3779b97f4a7c15ULL;
+        for (int i = 0; i < n; i++) {
+            // Permutação de 0..n-1 (multiplicação por ímpar módulo 2^20)
+            int chave = (int)((i * 2654435761u) & (n - 1));
+            inserirMultiFila(mf, chave, &semente);
+            somarFenwick(fenwick, n, chave, 1);
+        }
+        double soma = 0;
+        int maximo = 0, valor;
+        for (int restantes = n; excluirMultiFila(mf, &valor, &semente); restantes--) {
+            int posto = restantes - prefixoFenwick(fenwick, valor + 1);  // Chaves maiores ainda presentes
+            somarFenwick(fenwick, n, valor, -1);
+            soma += posto;
+            if (posto > maximo)
+                maximo = posto;
+        }
+        printf("%d,%d,%.2f,%d\n", filas, n, soma / n, maximo);
+        free(fenwick);
+        liberarMultiFila(mf);
+    }
+    return 0;
+}
+
+// Top-k (--topk [n]): vazão para k = 10 .. 10^6 sobre n inteiros aleatórios,
+// oferecendo um valor por vez, em lotes com pré-filtro e em paralelo
+int benchmarkTopK(long long n) {
+    int* dados = (int*)malloc(sizeof(int) * (size_t)n);
+    for (long long i = 0; i < n; i++)
+        dados[i] = (int)(benchAleatorio() & 0x7fffffff);
+    int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int* saida = (int*)malloc(sizeof(int) * 1000000);
+
+    printf("variante,k,n,threads,mvalores_s,menor_do_topo\n");
+    for (int k = 10; k <= 1000000; k *= 10) {
+        for (int variante = 0; variante < 3; variante++) {
+            uint64_t inicio = benchAgoraNs();
+            int total, threads = 1;
+            if (variante < 2) {
+                TopK* topk = criarTopK(k);
+                if (variante == 0) {
+                    for (long long i = 0; i < n; i++)
+                        oferecerTopK(topk, dados[i]);
+                } else {
+                    oferecerLoteTopK(topk, dados, (size_t)n);
+                }
+                total = extrairTopK(topk, saida);
+                liberarTopK(topk);
+            } else {
+                threads = nucleos;
+                total = topKParalelo(dados, (size_t)n, k, threads, saida);
+            }
+            double segundos = (benchAgoraNs() - inicio) / 1e9;
+            const char* nomes[] = {"um_por_vez", "lote", "paralelo"};
+            printf("%s,%d,%lld,%d,%.1f,%d\n", nomes[variante], k, n, threads, n / segundos / 1e6,
+                   saida[total - 1]);
+        }
+    }
+    free(saida);
+    free(dados);
+    return 0;
+}
+
+// Janela de mínimo e máximo (--minmax [n]): n valores e então 4n passos de uma
+// inserção seguida da remoção do mínimo ou do máximo (sorteado). Compara o heap
+// min-max com o contorno de dois heaps indexados em sincronia: um de máximo com
+// o valor e outro com o valor negado, e cada remoção apaga o id do outro heap
+int benchmarkMinMax(int n) {
+    long long passos = 4LL * n;
+    uint64_t semente = bench_estado;
+    long long soma = 0;
+
+    printf("variante,n,passos,ns_por_passo,bytes,soma\n");
+
+    // Heap min-max: um vetor de inteiros
+    int* vetor = (int*)malloc(sizeof(int) * (size_t)(n + 1));
+    int tamanho = 0;
+    modoSilencioso = 1;
+    uint64_t inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++)
+        inserirMinMax(vetor, &tamanho, (int)(benchAleatorio() & 0x3fffffff));
+    for (long long k = 0; k < passos; k++) {
+        inserirMinMax(vetor, &tamanho, (int)(benchAleatorio() & 0x3fffffff));
+        if (benchAleatorio() & 1)
+            soma += excluirMaximoMinMax(vetor, &tamanho);
+        else
+            soma -= excluirMinimoMinMax(vetor, &tamanho);
+    }
+    printf("minmax,%d,%lld,%.1f,%zu,%lld\n", n, passos, (double)(benchAgoraNs() - inicio) / (n + passos),
+           sizeof(int) * (size_t)(n + 1), soma);
+    free(vetor);
+
+    // Dois heaps indexados; os ids livres são reaproveitados por uma pilha
+    bench_estado = semente;
+    HeapIndexado* maiores = criarHeapIndexado(n + 1);
+    HeapIndexado* menores = criarHeapIndexado(n + 1);
+    int* livres = (int*)malloc(sizeof(int) * (size_t)(n + 1));
+    int numLivres = 0;
+    for (int id = n; id >= 0; id--)
+        livres[numLivres++] = id;
+    soma = 0;
+    inicio = benchAgoraNs();
+    for (long long k = 0; k < n + passos; k++) {
+        int valor = (int)(benchAleatorio() & 0x3fffffff);
+        int id = livres[--numLivres];
+        inserirHeapIndexado(maiores, id, valor);
+        inserirHeapIndexado(menores, id, -valor);
+        if (k < n)
+            continue;
+        int prioridade = 0;
+        if (benchAleatorio() & 1) {
+            id = excluirMaximoIndexado(maiores, &prioridade);
+            removerHeapIndexado(menores, id);
+            soma += prioridade;
+        } else {
+            id = excluirMaximoIndexado(menores, &prioridade);
+            removerHeapIndexado(maiores, id);
+            soma += prioridade;  // Já negada
+        }
+        livres[numLivres++] = id;
+    }
+    printf("dois_heaps,%d,%lld,%.1f,%zu,%lld\n", n, passos, (double)(benchAgoraNs() - inicio) / (n + passos),
+           2 * (sizeof(EntradaHeap) + sizeof(int)) * (size_t)(n + 1) + sizeof(int) * (size_t)(n + 1), soma);
+    liberarHeapIndexado(maiores);
+    liberarHeapIndexado(menores);
+    free(livres);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    AdaptadorBench adaptador = {.nome = "heapmax", .criar = benchCriar, .inserir = benchInserir,
+                                .buscar = benchBuscar, .remover = benchRemover, .altura = benchAltura};
+    AdaptadorBench dario = {.nome = ARIDADE == 8 ? "heap8ario" : ARIDADE == 16 ? "heap16ario" : ARIDADE == 2 ? "heap2ario" : "heap4ario",
+                            .criar = benchCriarDario, .inserir = benchInserirDario, .buscar = benchBuscarDario,
+                            .remover = benchRemoverDario, .altura = benchAlturaDario};
+
+    if (argc > 1 && !strcmp(argv[1], "--minmax"))
+        return benchmarkMinMax(argc > 2 ? atoi(argv[2]) : 1000000);
+    if (argc > 1 && !strcmp(argv[1], "--topk"))
+        return benchmarkTopK(argc > 2 ? atoll(argv[2]) : 100000000);
+    if (argc > 1 && !strcmp(argv[1], "--multifila"))
+        return benchmarkMultiFila(argc > 2 ? atoll(argv[2]) : 1000000, argc > 3 ? atoi(argv[3]) : 2);
+    if (argc > 1 && !strcmp(argv[1], "--indexado"))
+        return benchmarkIndexado(argc > 2 ? atoi(argv[2]) : 1000000);
+    if (argc > 1 && !strcmp(argv[1], "--ordenacao"))
+        return benchmarkOrdenacao(argc > 2 ? atoi(argv[2]) : 10000000);
+    if (argc > 1 && !strcmp(argv[1], "--push-pop"))
+        return benchmarkPushPop(argc > 2 ? atoi(argv[2]) : 10000000);
+    if (argc > 1 && !strcmp(argv[1], "--dario")) {
+        argv[1] = argv[0];
+        return executarBenchmark(&dario, argc - 1, argv + 1);
+    }
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main() {
     int vetor[] = {12, 11, 13, 5, 6, 7};
     int tamanho = sizeof(vetor) / sizeof(vetor[0]);
@@ -132,5 +1414,81 @@ int main() {
     // Excluir elementos do heap um por um e mostrar o heap após cada remoção
     excluirElementosHeap(vetor, &tamanho);
 
+    // Construção de Floyd e heapsort (sem impressão)
+    int dados[] = {12, 11, 13, 5, 6, 7, 42, 1, 30, 18, 25};
+    int quantos = sizeof(dados) / sizeof(dados[0]);
+    modoSilencioso = 1;
+    construirMaxHeap(dados, quantos);
+    printf("\nMax-Heap construído por Floyd: ");
+    imprimirVetor(dados, quantos);
+    heapSort(dados, quantos);
+    printf("Heapsort: ");
+    imprimirVetor(dados, quantos);
+    modoSilencioso = 0;
+
+    // Heap indexado: prioridades alteradas e identificador removido sem duplicatas
+    HeapIndexado* indexado = criarHeapIndexado(6);
+    for (int id = 0; id < 6; id++)
+        inserirHeapIndexado(indexado, id, 10 * id);
+    alterarPrioridade(indexado, 1, 100);  // Aumenta
+    alterarPrioridade(indexado, 5, 5);    // Diminui
+    removerHeapIndexado(indexado, 3);
+    printf("\nHeap indexado contém 3? %s\n", contemHeapIndexado(indexado, 3) ? "sim" : "não");
+    printf("Remoções do heap indexado (id:prioridade): ");
+    while (indexado->n > 0) {
+        int prioridade;
+        int id = excluirMaximoIndexado(indexado, &prioridade);
+        printf("%d:%d ", id, prioridade);
+    }
+    printf("\n");
+    liberarHeapIndexado(indexado);
+
+    // MultiFila com uma thread: as remoções saem quase em ordem decrescente
+    MultiFila* mf = criarMultiFila(2, 2);
+    uint64_t semente = 12345;
+    for (int i = 1; i <= 20; i++)
+        inserirMultiFila(mf, i, &semente);
+    printf("\nRemoções da MultiFila (%d filas): ", mf->numFilas);
+    int valor;
+    while (excluirMultiFila(mf, &valor, &semente))
+        printf("%d ", valor);
+    printf("\n");
+    liberarMultiFila(mf);
+
+    // Top-k: os 5 maiores de um fluxo, calculados em 3 pedaços e mesclados
+    int fluxo[40], maiores[5];
+    for (int i = 0; i < 40; i++)
+        fluxo[i] = (i * 37) % 101;
+    int encontrados = topKParalelo(fluxo, 40, 5, 3, maiores);
+    printf("\nTop-5 do fluxo: ");
+    imprimirVetor(maiores, encontrados);
+
+    // Heap d-ário: as remoções saem em ordem decrescente
+    int valores[] = {12, 11, 13, 5, 6, 7, 42, 1, 30, 18, 25};
+    HeapDario* heap = criarHeapDario(4);
+    for (int i = 0; i < 11; i++)
+        inserirHeapDario(heap, valores[i]);
+
+    printf("\nHeap %d-ário: ", ARIDADE);
+    imprimirVetor(heap->vetor, heap->n);
+    printf("Remoções do heap %d-ário: ", ARIDADE);
+    while (heap->n > 0)
+        printf("%d ", excluirHeapDario(heap));
+    printf("\n");
+    liberarHeapDario(heap);
+
+    // Heap min-max: retira alternadamente o menor e o maior
+    int janela[11];
+    int tamanhoJanela = 0;
+    for (int i = 0; i < 11; i++)
+        inserirMinMax(janela, &tamanhoJanela, valores[i]);
+    printf("\nHeap min-max: mínimo %d, máximo %d\n", minimoMinMax(janela, tamanhoJanela),
+           maximoMinMax(janela, tamanhoJanela));
+    printf("Remoções alternadas (mín, máx, ...): ");
+    for (int i = 0; tamanhoJanela > 0; i++)
+        printf("%d ", i % 2 ? excluirMaximoMinMax(janela, &tamanhoJanela) : excluirMinimoMinMax(janela, &tamanhoJanela));
+    printf("\n");
+
     return 0;
 }
+#endif
@@ -0,0 +1,441 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
+
+// Heap de pareamento (pairing heap) de máximo.
+//
+// Cada nó guarda o primeiro filho, o próximo irmão e 'anterior' (o irmão da
+// esquerda, ou o pai se for o primeiro filho). Ligar duas árvores é O(1): a de
+// menor raiz vira o primeiro filho da outra. Por isso inserir e fundir (meld)
+// são O(1); excluir a raiz junta os filhos em duas passadas (pares da esquerda
+// para a direita, depois da direita para a esquerda) em O(log n) amortizado.
+// Os nós vêm de um pool: blocos de NOS_POR_BLOCO nós e uma lista de livres.
+// Heaps que serão fundidos precisam compartilhar o mesmo pool.
+
+#define NOS_POR_BLOCO 4096
+
+// Estrutura de um nó do heap de pareamento
+typedef struct NoPareamento {
+    int chave;
+    struct NoPareamento* filho;     // Primeiro filho
+    struct NoPareamento* irmao;     // Próximo irmão (também encadeia a lista de livres)
+    struct NoPareamento* anterior;  // Irmão da esquerda ou pai
+} NoPareamento;
+
+// Estrutura de um bloco do pool
+typedef struct BlocoNos {
+    struct BlocoNos* proximo;
+    NoPareamento nos[NOS_POR_BLOCO];
+} BlocoNos;
+
+// Estrutura do pool de nós
+typedef struct PoolNos {
+    BlocoNos* blocos;
+    NoPareamento* livres;
+    int usadosNoBloco;  // Nós já entregues do bloco mais recente
+} PoolNos;
+
+// Estrutura do heap
+typedef struct HeapPareamento {
+    NoPareamento* raiz;
+    int n;
+    PoolNos* pool;
+} HeapPareamento;
+
+// Função para criar um pool vazio
+PoolNos* criarPool(void) {
+    PoolNos* pool = (PoolNos*)calloc(1, sizeof(PoolNos));
+    if (pool == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    pool->usadosNoBloco = NOS_POR_BLOCO;  // Força a alocação do primeiro bloco
+    return pool;
+}
+
+// Função para liberar o pool e todos os nós dele (de todos os heaps que o usam)
+void liberarPool(PoolNos* pool) {
+    while (pool->blocos != NULL) {
+        BlocoNos* proximo = pool->blocos->proximo;
+        free(pool->blocos);
+        pool->blocos = proximo;
+    }
+    free(pool);
+}
+
+// Função para pegar um nó do pool (reaproveita os livres antes de avançar no bloco)
+static inline NoPareamento* alocarNo(PoolNos* pool) {
+    if (pool->livres != NULL) {
+        NoPareamento* no = pool->livres;
+        pool->livres = no->irmao;
+        return no;
+    }
+    if (pool->usadosNoBloco == NOS_POR_BLOCO) {
+        BlocoNos* bloco = (BlocoNos*)malloc(sizeof(BlocoNos));
+        if (bloco == NULL) {
+            printf("Erro: Falha na alocação de memória.\n");
+            exit(-1);
+        }
+        bloco->proximo = pool->blocos;
+        pool->blocos = bloco;
+        pool->usadosNoBloco = 0;
+    }
+    return &pool->blocos->nos[pool->usadosNoBloco++];
+}
+
+static inline void devolverNo(PoolNos* pool, NoPareamento* no) {
+    no->irmao = pool->livres;
+    pool->livres = no;
+}
+
+// Função para criar um heap vazio que usa o pool informado
+HeapPareamento* criarHeapPareamento(PoolNos* pool) {
+    HeapPareamento* heap = (HeapPareamento*)malloc(sizeof(HeapPareamento));
+    if (heap == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    heap->raiz = NULL;
+    heap->n = 0;
+    heap->pool = pool;
+    return heap;
+}
+
+// Função para ligar duas árvores (raízes sem irmãos): a maior raiz adota a outra
+static inline NoPareamento* ligar(NoPareamento* a, NoPareamento* b) {
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (b->chave > a->chave) {
+        NoPareamento* temp = a;
+        a = b;
+        b = temp;
+    }
+    // b vira o primeiro filho de a
+    b->anterior = a;
+    b->irmao = a->filho;
+    if (a->filho != NULL)
+        a->filho->anterior = b;
+    a->filho = b;
+    a->irmao = NULL;
+    a->anterior = NULL;
+    return a;
+}
+
+// Função para juntar uma lista de irmãos numa única árvore (duas passadas)
+NoPareamento* juntarIrmaos(NoPareamento* primeiro) {
+    NoPareamento* pares = NULL;  // Resultado da 1ª passada, encadeado ao contrário
+
+    // 1ª passada: liga os irmãos dois a dois, da esquerda para a direita
+    while (primeiro != NULL) {
+        NoPareamento* a = primeiro;
+        NoPareamento* b = a->irmao;
+        primeiro = b != NULL ? b->irmao : NULL;
+        a->irmao = NULL;
+        if (b != NULL)
+            b->irmao = NULL;
+        NoPareamento* par = ligar(a, b);
+        par->irmao = pares;
+        pares = par;
+    }
+
+    // 2ª passada: acumula da direita para a esquerda (a lista já está invertida)
+    NoPareamento* resultado = NULL;
+    while (pares != NULL) {
+        NoPareamento* proximo = pares->irmao;
+        pares->irmao = NULL;
+        resultado = ligar(resultado, pares);
+        pares = proximo;
+    }
+    return resultado;
+}
+
+// Função para inserir uma chave; retorna o nó, que serve para alterar a chave depois
+NoPareamento* inserirPareamento(HeapPareamento* heap, int chave) {
+    NoPareamento* no = alocarNo(heap->pool);
+    no->chave = chave;
+    no->filho = NULL;
+    no->irmao = NULL;
+    no->anterior = NULL;
+    heap->raiz = ligar(heap->raiz, no);
+    heap->n++;
+    return no;
+}
+
+// Função para consultar o maior elemento sem removê-lo
+int topoPareamento(const HeapPareamento* heap) {
+    if (heap->raiz == NULL) {
+        printf("Heap vazio!\n");
+        return -1;
+    }
+    return heap->raiz->chave;
+}
+
+// Função para excluir a raiz (maior elemento)
+int excluirPareamento(HeapPareamento* heap) {
+    if (heap->raiz == NULL) {
+        printf("Heap vazio!\n");
+        return -1;
+    }
+    NoPareamento* raiz = heap->raiz;
+    int chave = raiz->chave;
+    heap->raiz = juntarIrmaos(raiz->filho);
+    heap->n--;
+    devolverNo(heap->pool, raiz);
+    return chave;
+}
+
+// Função para fundir 'origem' em 'destino' em O(1); 'origem' fica vazio
+void fundirPareamento(HeapPareamento* destino, HeapPareamento* origem) {
+    if (destino->pool != origem->pool) {
+        printf("Erro: Só é possível fundir heaps do mesmo pool.\n");
+        exit(-1);
+    }
+    destino->raiz = ligar(destino->raiz, origem->raiz);
+    destino->n += origem->n;
+    origem->raiz = NULL;
+    origem->n = 0;
+}
+
+// Função para destacar a subárvore de um nó (que não é a raiz) da lista de irmãos
+static void cortar(NoPareamento* no) {
+    if (no->anterior->filho == no)  // É o primeiro filho: 'anterior' é o pai
+        no->anterior->filho = no->irmao;
+    else
+        no->anterior->irmao = no->irmao;
+    if (no->irmao != NULL)
+        no->irmao->anterior = no->anterior;
+    no->irmao = NULL;
+    no->anterior = NULL;
+}
+
+// Função para mudar a chave de um nó: O(1) ao aumentar, O(log n) amortizado ao diminuir
+// Aumentar: a subárvore é cortada e religada à raiz (a ordem abaixo dela continua valendo)
+// Diminuir: o nó sai com os filhos juntados de volta ao heap e entra de novo sozinho
+void alterarChavePareamento(HeapPareamento* heap, NoPareamento* no, int chave) {
+    if (chave >= no->chave) {
+        no->chave = chave;
+        if (no != heap->raiz) {
+            cortar(no);
+            heap->raiz = ligar(heap->raiz, no);
+        }
+        return;
+    }
+
+    NoPareamento* filhos = juntarIrmaos(no->filho);
+    no->filho = NULL;
+    if (no == heap->raiz) {
+        heap->raiz = filhos;
+    } else {
+        cortar(no);
+        heap->raiz = ligar(heap->raiz, filhos);
+    }
+    no->chave = chave;
+    heap->raiz = ligar(heap->raiz, no);
+}
+
+// Função para devolver todos os nós do heap ao pool e liberar o heap
+void liberarHeapPareamento(HeapPareamento* heap) {
+    // Percorre achatando: os filhos de cada nó entram na lista de pendentes pelos irmãos
+    NoPareamento* pendentes = heap->raiz;
+    while (pendentes != NULL) {
+        NoPareamento* no = pendentes;
+        pendentes = no->irmao;
+        if (no->filho != NULL) {
+            NoPareamento* ultimo = no->filho;
+            while (ultimo->irmao != NULL)
+                ultimo = ultimo->irmao;
+            ultimo->irmao = pendentes;
+            pendentes = no->filho;
+        }
+        devolverNo(heap->pool, no);
+    }
+    free(heap);
+}
+
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK HeapPareamento.c -lm)
+// Buscar consulta o topo e remover exclui a raiz, como no adaptador de HeapMax.c
+// Com --fusao [n] [shards] compara fusões e remoções com o heap em vetor
+void* benchCriar(void) {
+    return criarHeapPareamento(criarPool());
+}
+
+void benchInserir(void* estrutura, int chave) {
+    inserirPareamento((HeapPareamento*)estrutura, chave);
+}
+
+int benchBuscar(void* estrutura, int chave) {
+    HeapPareamento* heap = (HeapPareamento*)estrutura;
+    return heap->raiz != NULL && heap->raiz->chave >= chave;
+}
+
+void benchRemover(void* estrutura, int chave) {
+    HeapPareamento* heap = (HeapPareamento*)estrutura;
+    (void)chave;
+    if (heap->raiz != NULL)
+        excluirPareamento(heap);
+}
+
+int benchAltura(void* estrutura) {
+    (void)estrutura;
+    return 0;  // A forma depende do histórico; não há altura significativa
+}
+
+// Heap binário em vetor de HeapMax.c (com buraco), para comparação
+typedef struct HeapVetor {
+    int* vetor;
+    int n;
+    int capacidade;
+} HeapVetor;
+
+void inserirHeapVetor(HeapVetor* heap, int chave) {
+    if (heap->n == heap->capacidade) {
+        heap->capacidade = heap->capacidade ? heap->capacidade * 2 : 1024;
+        heap->vetor = (int*)realloc(heap->vetor, sizeof(int) * heap->capacidade);
+    }
+    int i = heap->n++;
+    while (i > 0 && heap->vetor[(i - 1) / 2] < chave) {
+        heap->vetor[i] = heap->vetor[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap->vetor[i] = chave;
+}
+
+int excluirHeapVetor(HeapVetor* heap) {
+    int raiz = heap->vetor[0], valor = heap->vetor[--heap->n], i = 0;
+    while (2 * i + 1 < heap->n) {
+        int maior = 2 * i + 1;
+        if (maior + 1 < heap->n && heap->vetor[maior + 1] > heap->vetor[maior])
+            maior++;
+        if (heap->vetor[maior] <= valor)
+            break;
+        heap->vetor[i] = heap->vetor[maior];
+        i = maior;
+    }
+    heap->vetor[i] = valor;
+    return raiz;
+}
+
+// Fusões: 'shards' heaps com n/shards chaves são fundidos dois a dois até sobrar um
+// (tempo só das fusões), e então metade das chaves é removida (tempo à parte).
+// No vetor, fundir é esvaziar um heap e inserir no outro.
+// Remoções: n inserções seguidas de n remoções.
+int benchmarkFusao(int n, int shards) {
+    printf("variante,carga,n,shards,segundos,soma\n");
+    for (int variante = 0; variante < 2; variante++) {
+        PoolNos* pool = criarPool();
+        HeapPareamento** pareamento = (HeapPareamento**)malloc(sizeof(HeapPareamento*) * shards);
+        HeapVetor* vetores = (HeapVetor*)calloc(shards, sizeof(HeapVetor));
+        for (int s = 0; s < shards; s++)
+            pareamento[s] = criarHeapPareamento(pool);
+
+        bench_estado = 88172645463325252ULL;
+        for (int i = 0; i < n; i++) {
+            int chave = (int)(benchAleatorio() & 0x7fffffff);
+            if (variante == 0)
+                inserirPareamento(pareamento[i % shards], chave);
+            else
+                inserirHeapVetor(&vetores[i % shards], chave);
+        }
+
+        long long soma = 0;
+        uint64_t inicio = benchAgoraNs();
+        for (int passo = 1; passo < shards; passo *= 2) {
+            for (int s = 0; s + passo < shards; s += 2 * passo) {
+                if (variante == 0) {
+                    fundirPareamento(pareamento[s], pareamento[s + passo]);
+                } else {
+                    while (vetores[s + passo].n > 0)
+                        inserirHeapVetor(&vetores[s], excluirHeapVetor(&vetores[s + passo]));
+                }
+            }
+        }
+        uint64_t meio = benchAgoraNs();
+        for (int i = 0; i < n / 2; i++)
+            soma += variante == 0 ? excluirPareamento(pareamento[0]) : excluirHeapVetor(&vetores[0]);
+        uint64_t fim = benchAgoraNs();
+        printf("%s,fusao,%d,%d,%.6f,%lld\n", variante == 0 ? "pareamento" : "vetor", n, shards,
+               (meio - inicio) / 1e9, soma);
+        printf("%s,remocoes_apos_fusao,%d,%d,%.4f,%lld\n", variante == 0 ? "pareamento" : "vetor", n, shards,
+               (fim - meio) / 1e9, soma);
+
+        for (int s = 0; s < shards; s++) {
+            liberarHeapPareamento(pareamento[s]);
+            free(vetores[s].vetor);
+        }
+        free(vetores);
+        free(pareamento);
+
+        // Remoções
+        HeapPareamento* heap = criarHeapPareamento(pool);
+        HeapVetor vetor = {NULL, 0, 0};
+        bench_estado = 88172645463325252ULL;
+        soma = 0;
+        inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            int chave = (int)(benchAleatorio() & 0x7fffffff);
+            if (variante == 0)
+                inserirPareamento(heap, chave);
+            else
+                inserirHeapVetor(&vetor, chave);
+        }
+        for (int i = 0; i < n; i++)
+            soma += variante == 0 ? excluirPareamento(heap) : excluirHeapVetor(&vetor);
+        printf("%s,remocoes,%d,1,%.4f,%lld\n", variante == 0 ? "pareamento" : "vetor", n,
+               (benchAgoraNs() - inicio) / 1e9, soma);
+        liberarHeapPareamento(heap);
+        free(vetor.vetor);
+        liberarPool(pool);
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    AdaptadorBench adaptador = {.nome = "pareamento", .criar = benchCriar, .inserir = benchInserir,
+                                .buscar = benchBuscar, .remover = benchRemover, .altura = benchAltura};
+    if (argc > 1 && !strcmp(argv[1], "--fusao"))
+        return benchmarkFusao(argc > 2 ? atoi(argv[2]) : 4000000, argc > 3 ? atoi(argv[3]) : 1024);
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
+// Função auxiliar para esvaziar o heap imprimindo as remoções
+void esvaziarImprimindo(HeapPareamento* heap) {
+    while (heap->n > 0)
+        printf("%d ", excluirPareamento(heap));
+    printf("\n");
+}
+
+int main() {
+    PoolNos* pool = criarPool();
+    HeapPareamento* a = criarHeapPareamento(pool);
+    HeapPareamento* b = criarHeapPareamento(pool);
+
+    int valoresA[] = {12, 11, 13, 5, 6, 7};
+    int valoresB[] = {42, 1, 30, 18, 25};
+    NoPareamento* nos[6];
+    for (int i = 0; i < 6; i++)
+        nos[i] = inserirPareamento(a, valoresA[i]);
+    for (int i = 0; i < 5; i++)
+        inserirPareamento(b, valoresB[i]);
+
+    printf("Topo de A: %d, topo de B: %d\n", topoPareamento(a), topoPareamento(b));
+
+    // Altera chaves pelos nós devolvidos na inserção
+    alterarChavePareamento(a, nos[3], 50);  // 5 -> 50
+    alterarChavePareamento(a, nos[2], 2);   // 13 -> 2
+    printf("Topo de A após 5->50 e 13->2: %d\n", topoPareamento(a));
+
+    // Funde A em B em O(1) e esvazia B: as remoções saem em ordem decrescente
+    fundirPareamento(b, a);
+    printf("Remoções após fundir A em B: ");
+    esvaziarImprimindo(b);
+
+    liberarHeapPareamento(a);
+    liberarHeapPareamento(b);
+    liberarPool(pool);
+    return 0;
+}
+#endif
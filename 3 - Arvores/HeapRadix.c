@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece os temporizadores
+#endif
+
+// Heap radix (radix heap) para prioridades inteiras monótonas.
+//
+// Serve quando nenhuma chave inserida é menor que a última removida (relógios
+// de eventos, Dijkstra com pesos inteiros). As chaves ficam em baldes pelo bit
+// mais alto em que diferem da última removida: o balde 0 guarda as iguais a
+// ela e o balde b guarda as que diferem primeiro no bit b-1. Inserir é só
+// calcular esse bit e anexar; nenhuma chave é comparada com outra.
+// Remover esvazia o balde 0; quando ele acaba, o primeiro balde não vazio é
+// redistribuído em torno do seu menor elemento, e cada chave cai para um balde
+// estritamente menor. Como cada chave desce no máximo BITS_CHAVE vezes, as
+// operações custam O(log C) amortizado, sendo C o maior intervalo de chaves.
+// Compile com -DRADIX_32 para chaves de 32 bits (33 baldes em vez de 65).
+
+#ifdef RADIX_32
+typedef uint32_t ChaveRadix;
+#define BITS_CHAVE 32
+#define BIT_MAIS_ALTO(x) (32 - __builtin_clz(x))
+#else
+typedef uint64_t ChaveRadix;
+#define BITS_CHAVE 64
+#define BIT_MAIS_ALTO(x) (64 - __builtin_clzll(x))
+#endif
+
+// Estrutura de uma entrada: chave e um valor associado (o evento)
+typedef struct EntradaRadix {
+    ChaveRadix chave;
+    int valor;
+} EntradaRadix;
+
+// Estrutura de um balde: vetor que cresce e o menor elemento guardado
+typedef struct BaldeRadix {
+    EntradaRadix* itens;
+    int n;
+    int capacidade;
+    ChaveRadix minimo;
+} BaldeRadix;
+
+// Estrutura do heap radix
+typedef struct HeapRadix {
+    BaldeRadix baldes[BITS_CHAVE + 1];
+    ChaveRadix ultimo;  // Última chave removida (limite inferior das inserções)
+    long n;
+} HeapRadix;
+
+// Função para criar um heap radix vazio
+HeapRadix* criarHeapRadix(void) {
+    HeapRadix* heap = (HeapRadix*)calloc(1, sizeof(HeapRadix));
+    if (heap == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    return heap;
+}
+
+void liberarHeapRadix(HeapRadix* heap) {
+    for (int b = 0; b <= BITS_CHAVE; b++)
+        free(heap->baldes[b].itens);
+    free(heap);
+}
+
+// Função para anexar uma entrada a um balde
+static inline void anexarBalde(BaldeRadix* balde, ChaveRadix chave, int valor) {
+    if (balde->n == balde->capacidade) {
+        balde->capacidade = balde->capacidade ? balde->capacidade * 2 : 16;
+        balde->itens = (EntradaRadix*)realloc(balde->itens, sizeof(EntradaRadix) * balde->capacidade);
+        if (balde->itens == NULL) {
+            printf("Erro: Falha na alocação de memória.\n");
+            exit(-1);
+        }
+    }
+    if (balde->n == 0 || chave < balde->minimo)
+        balde->minimo = chave;
+    balde->itens[balde->n].chave = chave;
+    balde->itens[balde->n].valor = valor;
+    balde->n++;
+}
+
+// Função para calcular o balde de uma chave: o bit mais alto que difere da última removida
+static inline int baldeDaChave(ChaveRadix chave, ChaveRadix ultimo) {
+    ChaveRadix diferenca = chave ^ ultimo;
+    return diferenca == 0 ? 0 : BIT_MAIS_ALTO(diferenca);
+}
+
+// Função para inserir uma chave (não pode ser menor que a última removida)
+void inserirHeapRadix(HeapRadix* heap, ChaveRadix chave, int valor) {
+    if (chave < heap->ultimo) {
+        printf("Erro: Chave menor que a última removida (o heap radix é monótono).\n");
+        exit(-1);
+    }
+    anexarBalde(&heap->baldes[baldeDaChave(chave, heap->ultimo)], chave, valor);
+    heap->n++;
+}
+
+// Função para remover a menor chave; devolve o valor associado em *valor
+// Retorna 0 se o heap estiver vazio
+int excluirHeapRadix(HeapRadix* heap, ChaveRadix* chave, int* valor) {
+    if (heap->n == 0)
+        return 0;
+
+    if (heap->baldes[0].n == 0) {
+        // Redistribui o primeiro balde não vazio em torno do seu menor elemento
+        int b = 1;
+        while (heap->baldes[b].n == 0)
+            b++;
+        BaldeRadix* origem = &heap->baldes[b];
+        heap->ultimo = origem->minimo;
+        for (int i = 0; i < origem->n; i++) {
+            EntradaRadix* e = &origem->itens[i];
+            anexarBalde(&heap->baldes[baldeDaChave(e->chave, heap->ultimo)], e->chave, e->valor);
+        }
+        origem->n = 0;
+    }
+
+    BaldeRadix* zero = &heap->baldes[0];
+    zero->n--;
+    if (chave != NULL)
+        *chave = zero->itens[zero->n].chave;
+    if (valor != NULL)
+        *valor = zero->itens[zero->n].valor;
+    heap->n--;
+    return 1;
+}
+
+// Função para consultar a menor chave sem removê-la (o heap não pode estar vazio)
+ChaveRadix topoHeapRadix(const HeapRadix* heap) {
+    if (heap->baldes[0].n > 0)
+        return heap->ultimo;
+    int b = 1;
+    while (heap->baldes[b].n == 0)
+        b++;
+    return heap->baldes[b].minimo;
+}
+
+#ifdef BENCHMARK
+// Benchmark de temporizadores (gcc -O2 -DBENCHMARK HeapRadix.c -lm)
+// Uso: ./bench [pendentes ...]  (padrão 1000 100000 1000000)
+// Cada passo remove o evento mais próximo no tempo t e agenda outro em t + atraso,
+// com atraso aleatório de 1 a 2^20. Compara com um heap binário de mínimo em vetor.
+
+#define PASSOS 10000000
+#define ATRASO_MAXIMO (1u << 20)
+
+// Heap binário de mínimo (o de HeapMax.c com a comparação invertida), com buraco
+typedef struct HeapBinario {
+    EntradaRadix* itens;
+    int n;
+} HeapBinario;
+
+static inline void inserirHeapBinario(HeapBinario* heap, ChaveRadix chave, int valor) {
+    int i = heap->n++;
+    while (i > 0 && heap->itens[(i - 1) / 2].chave > chave) {
+        heap->itens[i] = heap->itens[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap->itens[i].chave = chave;
+    heap->itens[i].valor = valor;
+}
+
+static inline EntradaRadix excluirHeapBinario(HeapBinario* heap) {
+    EntradaRadix raiz = heap->itens[0], ultimo = heap->itens[--heap->n];
+    int i = 0;
+    while (2 * i + 1 < heap->n) {
+        int menor = 2 * i + 1;
+        if (menor + 1 < heap->n && heap->itens[menor + 1].chave < heap->itens[menor].chave)
+            menor++;
+        if (heap->itens[menor].chave >= ultimo.chave)
+            break;
+        heap->itens[i] = heap->itens[menor];
+        i = menor;
+    }
+    heap->itens[i] = ultimo;
+    return raiz;
+}
+
+int main(int argc, char* argv[]) {
+    int padrao[] = {1000, 100000, 1000000};
+    int quantos = argc > 1 ? argc - 1 : 3;
+
+    printf("variante,bits,pendentes,passos,ns_por_passo,soma\n");
+    for (int t = 0; t < quantos; t++) {
+        int pendentes = argc > 1 ? atoi(argv[t + 1]) : padrao[t];
+
+        for (int variante = 0; variante < 2; variante++) {
+            HeapRadix* radix = criarHeapRadix();
+            HeapBinario binario = {(EntradaRadix*)malloc(sizeof(EntradaRadix) * pendentes), 0};
+            bench_estado = 88172645463325252ULL;
+
+            for (int i = 0; i < pendentes; i++) {
+                ChaveRadix quando = 1 + benchAleatorio() % ATRASO_MAXIMO;
+                if (variante == 0)
+                    inserirHeapRadix(radix, quando, i);
+                else
+                    inserirHeapBinario(&binario, quando, i);
+            }
+
+            unsigned long long soma = 0;
+            uint64_t inicio = benchAgoraNs();
+            for (int passo = 0; passo < PASSOS; passo++) {
+                ChaveRadix agora = 0;
+                int evento = 0;
+                if (variante == 0) {
+                    excluirHeapRadix(radix, &agora, &evento);
+                } else {
+                    EntradaRadix e = excluirHeapBinario(&binario);
+                    agora = e.chave;
+                    evento = e.valor;
+                }
+                soma += agora;  // Empates podem sair em ordem diferente, as chaves não
+                ChaveRadix proximo = agora + 1 + benchAleatorio() % ATRASO_MAXIMO;
+                if (variante == 0)
+                    inserirHeapRadix(radix, proximo, evento);
+                else
+                    inserirHeapBinario(&binario, proximo, evento);
+            }
+            printf("%s,%d,%d,%d,%.1f,%llu\n", variante == 0 ? "radix" : "binario", BITS_CHAVE, pendentes,
+                   PASSOS, (double)(benchAgoraNs() - inicio) / PASSOS, soma);
+
+            liberarHeapRadix(radix);
+            free(binario.itens);
+        }
+    }
+    return 0;
+}
+#else
+int main() {
+    HeapRadix* heap = criarHeapRadix();
+    ChaveRadix tempos[] = {50, 7, 1000, 7, 3, 64, 65, 900};
+    int n = sizeof(tempos) / sizeof(tempos[0]);
+
+    for (int i = 0; i < n; i++)
+        inserirHeapRadix(heap, tempos[i], i);
+    printf("Menor chave: %llu\n", (unsigned long long)topoHeapRadix(heap));
+
+    // Remove três e agenda novos eventos no futuro (monótono)
+    ChaveRadix chave;
+    int valor;
+    printf("Removidos: ");
+    for (int i = 0; i < 3; i++) {
+        excluirHeapRadix(heap, &chave, &valor);
+        printf("%llu(evento %d) ", (unsigned long long)chave, valor);
+    }
+    printf("\n");
+    inserirHeapRadix(heap, chave + 10, 100);
+    inserirHeapRadix(heap, chave, 101);
+
+    printf("Restantes em ordem: ");
+    while (excluirHeapRadix(heap, &chave, &valor))
+        printf("%llu(evento %d) ", (unsigned long long)chave, valor);
+    printf("\n");
+
+    liberarHeapRadix(heap);
+    return 0;
+}
+#endif
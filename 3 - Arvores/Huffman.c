@@ -1,14 +1,58 @@
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Fornece os temporizadores e os geradores
+// Os contadores de memória do driver não são atômicos e os blocos alocam em
+// várias threads; este benchmark só mede vazão, então usa o malloc da libc
+#undef malloc
+#undef free
+#undef calloc
+#undef realloc
+#endif
+
+// Compressor de Huffman para arquivos binários quaisquer.
+//
+// Formato: "HUF3", tamanho original (8 bytes, little-endian) e tamanho do
+// bloco (4 bytes). A entrada é dividida em blocos independentes, comprimidos e
+// descomprimidos em paralelo. Cada bloco tem a sua tabela: mapa de 32 bytes
+// com os símbolos presentes, um byte de comprimento de código por símbolo
+// presente e o tamanho em bytes de cada um dos 4 fluxos (4 bytes cada). Depois
+// vêm os fluxos, com os códigos empacotados do bit mais alto para o mais baixo,
+// e 8 bytes zerados. No fim do arquivo fica o índice com o tamanho comprimido
+// de cada bloco. Os códigos são canônicos: só os comprimentos vão na tabela, e
+// o decodificador refaz os mesmos códigos a partir deles.
+//
+// Uso: ./huffman -c|-d [-t threads] [-b KB] [-l bits] [entrada|-] [saida|-]
+//      ./huffman -a [-r KB] [entrada|-] [saida|-]  (modo adaptativo, para fluxos ao vivo)
+//      ./huffman -f [-t threads] [entrada|-] [saida|-]  (só as frequências, em CSV)
+// (sem argumentos lê uma linha e mostra os códigos)
+// Compilar com: gcc -O2 -pthread Huffman.c -o huffman
+// Arquivos de entrada são mapeados com mmap; a entrada padrão é lida toda
+// para a memória, porque a compressão precisa de duas passadas. O modo
+// adaptativo (-a: FGK; -a -r KB: códigos refeitos a cada KB) lê e grava aos
+// poucos, em uma passada; -d reconhece os dois formatos.
 
 #define MAX_SIZE 256
+#define MAX_COMPRIMENTO 32  // Maior código aceito (cabe no buffer de 64 bits)
+#define LIMITE_PADRAO 11  // Igual a TABELA_BITS: todo código cabe na tabela do decodificador
+#define TAMANHO_CABECALHO 16  // Assinatura + tamanho original + tamanho do bloco
+#define TAMANHO_MAPA 32  // Um bit por símbolo presente no bloco
+#define BLOCO_PADRAO (1 << 20)
+#define BLOCO_MAXIMO (64 << 20)
 
 // Estrutura para representar um nó na árvore de Huffman
 typedef struct No
 {
-    char caractere;
-    int frequencia;
+    unsigned char caractere;
+    uint64_t frequencia;
     struct No *esquerda, *direita;
 } No;
 
@@ -21,9 +65,14 @@ typedef struct
 } FilaPrioridade;
 
 // Função para criar um novo nó
-No *novoNo(char caractere, int frequencia)
+No *novoNo(unsigned char caractere, uint64_t frequencia)
 {
     No *no = (No *)malloc(sizeof(No));
+    if (no == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
     no->caractere = caractere;
     no->frequencia = frequencia;
     no->esquerda = no->direita = NULL;
@@ -40,6 +89,12 @@ FilaPrioridade *criarFilaPrioridade(int capacidade)
     return fila;
 }
 
+void liberarFilaPrioridade(FilaPrioridade *fila)
+{
+    free(fila->array);
+    free(fila);
+}
+
 // Função para trocar dois nós
 void trocar(No **a, No **b)
 {
@@ -98,7 +153,8 @@ void inserir(FilaPrioridade *fila, No *no)
 }
 
 // Função para construir a árvore de Huffman
-No *construirArvoreHuffman(char caracteres[], int frequencias[], int tamanho)
+// 'caracteres' deve ter cada símbolo uma única vez, com a sua frequência
+No *construirArvoreHuffman(unsigned char caracteres[], uint64_t frequencias[], int tamanho)
 {
     No *esquerda, *direita, *topo;
     FilaPrioridade *fila = criarFilaPrioridade(tamanho);
@@ -118,7 +174,19 @@ No *construirArvoreHuffman(char caracteres[], int frequencias[], int tamanho)
         inserir(fila, topo);
     }
 
-    return extrairMinimo(fila);
+    No *raiz = extrairMinimo(fila);
+    liberarFilaPrioridade(fila);
+    return raiz;
+}
+
+void liberarArvoreHuffman(No *raiz)
+{
+    if (raiz != NULL)
+    {
+        liberarArvoreHuffman(raiz->esquerda);
+        liberarArvoreHuffman(raiz->direita);
+        free(raiz);
+    }
 }
 
 // Função para imprimir códigos Huffman a partir da árvore de Huffman
@@ -138,32 +206,2202 @@ void imprimirCodigosHuffman(No *raiz, int codigo[], int indice)
 
     if (!raiz->esquerda && !raiz->direita)
     {
-        printf("%c: ", raiz->caractere);
+        if (raiz->caractere >= 32 && raiz->caractere < 127)
+            printf("'%c': ", raiz->caractere);
+        else
+            printf("\\x%02x: ", raiz->caractere);
         for (int i = 0; i < indice; ++i)
             printf("%d", codigo[i]);
         printf("\n");
     }
 }
 
+// ---------------------------------------------------------------------------
+// Comprimentos e códigos canônicos
+// ---------------------------------------------------------------------------
+
+// Um contador único serializa os incrementos quando um byte se repete: cada
+// um espera a gravação do anterior no mesmo endereço. Com bytes vizinhos
+// contados em tabelas diferentes, os incrementos seguidos são independentes.
+// As tabelas usam 32 bits (cabem no cache L1) e são somadas a cada pedaço
+#define TABELAS_HISTOGRAMA 4
+#define PEDACO_HISTOGRAMA ((size_t)1 << 30)  // Até 2^28 bytes por tabela: sem transbordo
+
+// Função para contar quantas vezes cada byte aparece
+void contarFrequencias(const unsigned char *dados, size_t n, uint64_t frequencias[MAX_SIZE])
+{
+    uint32_t tabelas[TABELAS_HISTOGRAMA][MAX_SIZE];
+    memset(frequencias, 0, MAX_SIZE * sizeof(uint64_t));
+    while (n > 0)
+    {
+        size_t pedaco = n < PEDACO_HISTOGRAMA ? n : PEDACO_HISTOGRAMA, i = 0;
+        memset(tabelas, 0, sizeof(tabelas));
+        for (; i + 8 <= pedaco; i += 8)
+        {
+            uint64_t palavra;
+            memcpy(&palavra, dados + i, 8);
+            tabelas[0][palavra & 0xff]++;
+            tabelas[1][(palavra >> 8) & 0xff]++;
+            tabelas[2][(palavra >> 16) & 0xff]++;
+            tabelas[3][(palavra >> 24) & 0xff]++;
+            tabelas[0][(palavra >> 32) & 0xff]++;
+            tabelas[1][(palavra >> 40) & 0xff]++;
+            tabelas[2][(palavra >> 48) & 0xff]++;
+            tabelas[3][palavra >> 56]++;
+        }
+        for (; i < pedaco; i++)
+            tabelas[0][dados[i]]++;
+        for (int c = 0; c < MAX_SIZE; c++)
+            frequencias[c] += (uint64_t)tabelas[0][c] + tabelas[1][c] + tabelas[2][c] + tabelas[3][c];
+        dados += pedaco;
+        n -= pedaco;
+    }
+}
+
+// Parte da entrada contada por uma thread
+typedef struct ParteHistograma
+{
+    const unsigned char *dados;
+    size_t n;
+    int emThread;  // 1 se a parte foi contada por uma thread que precisa de join
+    uint64_t frequencias[MAX_SIZE];
+} ParteHistograma;
+
+void *contarParte(void *arg)
+{
+    ParteHistograma *parte = (ParteHistograma *)arg;
+    contarFrequencias(parte->dados, parte->n, parte->frequencias);
+    return NULL;
+}
+
+// Função para contar as frequências com 'numThreads' threads, uma por pedaço
+// contíguo da entrada; as contagens de cada uma são somadas no fim
+void contarFrequenciasParalelo(const unsigned char *dados, size_t n, int numThreads, uint64_t frequencias[MAX_SIZE])
+{
+    if (numThreads < 2 || n < PEDACO_HISTOGRAMA / 64)
+    {
+        contarFrequencias(dados, n, frequencias);
+        return;
+    }
+    ParteHistograma *partes = (ParteHistograma *)malloc(numThreads * sizeof(ParteHistograma));
+    pthread_t *ids = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (partes == NULL || ids == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    size_t pedaco = n / numThreads;
+    for (int t = 0; t < numThreads; t++)
+    {
+        partes[t].dados = dados + t * pedaco;
+        partes[t].n = t == numThreads - 1 ? n - t * pedaco : pedaco;
+        partes[t].emThread = t > 0 && pthread_create(&ids[t], NULL, contarParte, &partes[t]) == 0;
+    }
+    // A thread principal conta a primeira parte e as que não ganharam thread
+    for (int t = 0; t < numThreads; t++)
+    {
+        if (!partes[t].emThread)
+            contarParte(&partes[t]);
+    }
+
+    memcpy(frequencias, partes[0].frequencias, sizeof(partes[0].frequencias));
+    for (int t = 1; t < numThreads; t++)
+    {
+        if (partes[t].emThread)
+            pthread_join(ids[t], NULL);
+        for (int c = 0; c < MAX_SIZE; c++)
+            frequencias[c] += partes[t].frequencias[c];
+    }
+    free(partes);
+    free(ids);
+}
+
+// Função para comparar duas chaves de 64 bits (qsort)
+int compararChaves(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Função para calcular os comprimentos com duas filas, no próprio vetor
+// (Moffat e Katajainen). Com os pesos em ordem crescente, os nós internos
+// também nascem em ordem crescente, então a menor soma está sempre no início
+// das folhas restantes ou no início dos nós internos: nenhum heap é preciso.
+// 1ª fase: A[i] vira o peso do i-ésimo nó interno e depois o índice do pai
+// 2ª fase: o índice do pai vira a profundidade do nó interno
+// 3ª fase: as profundidades das folhas saem, das mais rasas (maior peso) às
+// mais fundas, a partir de quantos nós internos há em cada nível
+// Ao final A[i] é o comprimento do código do i-ésimo menor peso (n >= 2)
+void comprimentosDuasFilas(uint64_t A[], int n)
+{
+    int raiz = 0, folha = 2;
+    A[0] += A[1];
+    for (int proximo = 1; proximo < n - 1; proximo++)
+    {
+        // Primeiro filho: a menor entre a próxima folha e o próximo nó interno
+        if (folha >= n || A[raiz] < A[folha])
+        {
+            A[proximo] = A[raiz];
+            A[raiz++] = proximo;
+        }
+        else
+            A[proximo] = A[folha++];
+
+        // Segundo filho
+        if (folha >= n || (raiz < proximo && A[raiz] < A[folha]))
+        {
+            A[proximo] += A[raiz];
+            A[raiz++] = proximo;
+        }
+        else
+            A[proximo] += A[folha++];
+    }
+
+    A[n - 2] = 0;
+    for (int proximo = n - 3; proximo >= 0; proximo--)
+        A[proximo] = A[A[proximo]] + 1;
+
+    int disponiveis = 1, usados = 0, profundidade = 0, proximo = n - 1;
+    raiz = n - 2;
+    while (disponiveis > 0)
+    {
+        while (raiz >= 0 && A[raiz] == (uint64_t)profundidade)
+        {
+            usados++;
+            raiz--;
+        }
+        while (disponiveis > usados)
+        {
+            A[proximo--] = profundidade;
+            disponiveis--;
+        }
+        disponiveis = 2 * usados;
+        profundidade++;
+        usados = 0;
+    }
+}
+
+// Função para limitar os comprimentos a 'limite' bits
+// 'quantos[k]' é o número de códigos de k bits (k até MAX_SIZE - 1). Os
+// códigos longos demais passam a ter 'limite' bits, o que estoura a
+// desigualdade de Kraft; cada passo seguinte tira uma folha do último nível e
+// divide a folha mais funda acima dele em duas, reduzindo o excesso em um
+// (a heurística do deflate do miniz; fica a poucos milésimos do ótimo)
+void limitarComprimentos(int quantos[MAX_SIZE], int limite)
+{
+    for (int k = limite + 1; k < MAX_SIZE; k++)
+    {
+        quantos[limite] += quantos[k];
+        quantos[k] = 0;
+    }
+    uint64_t total = 0;
+    for (int k = 1; k <= limite; k++)
+        total += (uint64_t)quantos[k] << (limite - k);
+    while (total > (uint64_t)1 << limite)
+    {
+        quantos[limite]--;
+        for (int k = limite - 1; k > 0; k--)
+        {
+            if (quantos[k] > 0)
+            {
+                quantos[k]--;
+                quantos[k + 1] += 2;
+                break;
+            }
+        }
+        total--;
+    }
+}
+
+// Função para calcular o comprimento do código de cada byte (0 = ausente),
+// sem passar de 'limite' bits (2^limite >= símbolos presentes); retorna o maior
+// Os símbolos são ordenados pela frequência (chave = frequência << 8 | byte,
+// então as frequências devem caber em 56 bits) e os comprimentos saem das duas
+// filas em O(n), sem alocar nós. Como só os comprimentos vão no cabeçalho, os
+// códigos em si são os canônicos de gerarCodigosCanonicos
+int comprimentosHuffman(const uint64_t frequencias[MAX_SIZE], unsigned char comprimentos[MAX_SIZE], int limite)
+{
+    uint64_t chaves[MAX_SIZE], A[MAX_SIZE];
+    int tamanho = 0;
+
+    memset(comprimentos, 0, MAX_SIZE);
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (frequencias[c] > 0)
+            chaves[tamanho++] = frequencias[c] << 8 | (uint64_t)c;
+    }
+    if (tamanho == 0)
+        return 0;
+    if (tamanho == 1)
+    {
+        // Um símbolo sozinho ainda precisa de um bit por ocorrência
+        comprimentos[chaves[0] & 0xff] = 1;
+        return 1;
+    }
+
+    qsort(chaves, tamanho, sizeof(uint64_t), compararChaves);
+    for (int i = 0; i < tamanho; i++)
+        A[i] = chaves[i] >> 8;
+    comprimentosDuasFilas(A, tamanho);
+
+    // Os comprimentos são decrescentes em A; se o maior passar do limite, os
+    // comprimentos limitados são redistribuídos na mesma ordem
+    int maior = (int)A[0];
+    if (maior > limite)
+    {
+        int quantos[MAX_SIZE] = {0};
+        for (int i = 0; i < tamanho; i++)
+            quantos[A[i]]++;
+        limitarComprimentos(quantos, limite);
+        int k = limite;
+        for (int i = 0; i < tamanho; i++)
+        {
+            while (quantos[k] == 0)
+                k--;
+            A[i] = k;
+            quantos[k]--;
+        }
+        maior = limite;
+    }
+    for (int i = 0; i < tamanho; i++)
+        comprimentos[chaves[i] & 0xff] = (unsigned char)A[i];
+    return maior;
+}
+
+// Função para gerar os códigos canônicos a partir dos comprimentos
+// Em cada comprimento, os símbolos recebem códigos consecutivos em ordem de
+// byte, começando logo após o último código do comprimento anterior deslocado
+void gerarCodigosCanonicos(const unsigned char comprimentos[MAX_SIZE], uint32_t codigos[MAX_SIZE])
+{
+    int quantos[MAX_COMPRIMENTO + 1] = {0};
+    uint32_t proximo[MAX_COMPRIMENTO + 2];
+
+    for (int c = 0; c < MAX_SIZE; c++)
+        quantos[comprimentos[c]]++;
+    quantos[0] = 0;
+
+    uint32_t codigo = 0;
+    for (int comprimento = 1; comprimento <= MAX_COMPRIMENTO; comprimento++)
+    {
+        codigo = (codigo + quantos[comprimento - 1]) << 1;
+        proximo[comprimento] = codigo;
+    }
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (comprimentos[c] > 0)
+            codigos[c] = proximo[comprimentos[c]]++;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Saída com buffer (arquivo ou memória)
+// ---------------------------------------------------------------------------
+
+#define TAMANHO_BUFFER_SAIDA (1 << 16)
+
+// Estrutura de saída: grava em 'arquivo' ou, se ele for NULL, acumula em 'memoria'
+typedef struct Saida
+{
+    FILE *arquivo;
+    unsigned char *memoria;
+    size_t tamanho;      // Bytes guardados em 'memoria'
+    size_t capacidade;
+    unsigned char buffer[TAMANHO_BUFFER_SAIDA];
+    size_t usados;
+} Saida;
+
+void esvaziarSaida(Saida *saida)
+{
+    if (saida->usados == 0)
+        return;
+    if (saida->arquivo != NULL)
+    {
+        if (fwrite(saida->buffer, 1, saida->usados, saida->arquivo) != saida->usados)
+        {
+            fprintf(stderr, "Erro: Falha na gravação.\n");
+            exit(-1);
+        }
+    }
+    else
+    {
+        if (saida->tamanho + saida->usados > saida->capacidade)
+        {
+            saida->capacidade = (saida->tamanho + saida->usados) * 2;
+            saida->memoria = (unsigned char *)realloc(saida->memoria, saida->capacidade);
+            if (saida->memoria == NULL)
+            {
+                fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+                exit(-1);
+            }
+        }
+        memcpy(saida->memoria + saida->tamanho, saida->buffer, saida->usados);
+        saida->tamanho += saida->usados;
+    }
+    saida->usados = 0;
+}
+
+static inline void escreverBytes(Saida *saida, const void *dados, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)dados;
+    while (n > 0)
+    {
+        size_t parte = TAMANHO_BUFFER_SAIDA - saida->usados;
+        if (parte > n)
+            parte = n;
+        memcpy(saida->buffer + saida->usados, p, parte);
+        saida->usados += parte;
+        p += parte;
+        n -= parte;
+        if (saida->usados == TAMANHO_BUFFER_SAIDA)
+            esvaziarSaida(saida);
+    }
+}
+
+static inline void escreverByte(Saida *saida, unsigned char byte)
+{
+    saida->buffer[saida->usados++] = byte;
+    if (saida->usados == TAMANHO_BUFFER_SAIDA)
+        esvaziarSaida(saida);
+}
+
+// ---------------------------------------------------------------------------
+// Compressão
+// ---------------------------------------------------------------------------
+
+// Cada bloco tem a sua própria tabela de códigos e é dividido em NUM_FLUXOS
+// pedaços consecutivos, e cada pedaço vira um fluxo de bits separado. Os fluxos
+// são independentes, então o decodificador avança os quatro no mesmo laço e o
+// processador sobrepõe as consultas.
+#define NUM_FLUXOS 4
+#define PREENCHIMENTO 8  // Bytes zerados após o último fluxo (leituras de 64 bits)
+
+// Função para calcular onde começa o pedaço 'j' de uma entrada de 'n' bytes
+static inline uint64_t inicioPedaco(uint64_t n, int j)
+{
+    uint64_t pedaco = (n + NUM_FLUXOS - 1) / NUM_FLUXOS;
+    return pedaco * j < n ? pedaco * j : n;
+}
+
+// Funções para gravar e ler inteiros em little-endian
+static void escreverU32(Saida *saida, uint32_t valor)
+{
+    unsigned char bytes[4] = {(unsigned char)valor, (unsigned char)(valor >> 8), (unsigned char)(valor >> 16),
+                              (unsigned char)(valor >> 24)};
+    escreverBytes(saida, bytes, 4);
+}
+
+static inline uint64_t lerInteiro(const unsigned char *dados, int bytes)
+{
+    uint64_t valor = 0;
+    for (int i = 0; i < bytes; i++)
+        valor |= (uint64_t)dados[i] << (8 * i);
+    return valor;
+}
+
+// Função para gravar a tabela de um bloco: mapa dos símbolos presentes e comprimentos
+void escreverTabelaBloco(Saida *saida, const unsigned char comprimentos[MAX_SIZE])
+{
+    unsigned char mapa[TAMANHO_MAPA] = {0};
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (comprimentos[c] > 0)
+            mapa[c / 8] |= (unsigned char)(1 << (c % 8));
+    }
+    escreverBytes(saida, mapa, TAMANHO_MAPA);
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (comprimentos[c] > 0)
+            escreverByte(saida, comprimentos[c]);
+    }
+}
+
+// Função para codificar um pedaço num fluxo de bits
+// Os códigos entram pela direita de um buffer de 64 bits; a cada 32 bits
+// acumulados, os 32 mais antigos saem de uma vez (código <= 32 bits, então o
+// buffer nunca passa de 63 bits ocupados). O último byte é completado com zeros
+void codificarFluxo(const unsigned char *dados, size_t n, const unsigned char comprimentos[MAX_SIZE],
+                    const uint32_t codigos[MAX_SIZE], Saida *saida)
+{
+    uint64_t bits = 0;
+    int contagem = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned char c = dados[i];
+        bits = (bits << comprimentos[c]) | codigos[c];
+        contagem += comprimentos[c];
+        if (contagem >= 32)
+        {
+            contagem -= 32;
+            uint32_t palavra = (uint32_t)(bits >> contagem);
+            unsigned char bytes[4] = {(unsigned char)(palavra >> 24), (unsigned char)(palavra >> 16),
+                                      (unsigned char)(palavra >> 8), (unsigned char)palavra};
+            escreverBytes(saida, bytes, 4);
+        }
+    }
+    while (contagem > 0)
+    {
+        int deslocamento = contagem - 8;
+        escreverByte(saida, (unsigned char)(deslocamento >= 0 ? bits >> deslocamento : bits << -deslocamento));
+        contagem -= 8;
+    }
+}
+
+// Função para comprimir um bloco de 'n' bytes (n <= BLOCO_MAXIMO)
+// O histograma é feito por pedaço: somado dá as frequências da árvore e,
+// junto com os comprimentos, o tamanho exato de cada fluxo, que vai antes dos
+// dados. Assim nada precisa ser guardado além da própria saída
+void comprimirBloco(const unsigned char *dados, size_t n, Saida *saida, int limite)
+{
+    uint64_t frequencias[MAX_SIZE] = {0};
+    uint64_t parciais[NUM_FLUXOS][MAX_SIZE];
+    unsigned char comprimentos[MAX_SIZE];
+    uint32_t codigos[MAX_SIZE];
+
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        uint64_t inicio = inicioPedaco(n, j);
+        contarFrequencias(dados + inicio, inicioPedaco(n, j + 1) - inicio, parciais[j]);
+        for (int c = 0; c < MAX_SIZE; c++)
+            frequencias[c] += parciais[j][c];
+    }
+    comprimentosHuffman(frequencias, comprimentos, limite);
+    gerarCodigosCanonicos(comprimentos, codigos);
+
+    escreverTabelaBloco(saida, comprimentos);
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        uint64_t bits = 0;
+        for (int c = 0; c < MAX_SIZE; c++)
+            bits += parciais[j][c] * comprimentos[c];
+        escreverU32(saida, (uint32_t)((bits + 7) / 8));
+    }
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        uint64_t inicio = inicioPedaco(n, j);
+        codificarFluxo(dados + inicio, inicioPedaco(n, j + 1) - inicio, comprimentos, codigos, saida);
+    }
+    for (int i = 0; i < PREENCHIMENTO; i++)
+        escreverByte(saida, 0);
+    esvaziarSaida(saida);
+}
+
+// ---------------------------------------------------------------------------
+// Descompressão
+// ---------------------------------------------------------------------------
+
+// A decodificação consulta uma tabela indexada pelos próximos TABELA_BITS bits.
+// Cada entrada diz quantos bits consumir e qual símbolo sai; quando o código do
+// primeiro símbolo deixa bits sobrando na janela e o seguinte também cabe nela,
+// a entrada já traz os dois símbolos. Prefixos de códigos mais longos que a
+// janela ficam marcados e vão para a decodificação canônica, bit a bit.
+#define TABELA_BITS 11
+
+// Entrada da tabela: 4 bytes, a tabela inteira (8 KB) cabe na cache L1. O laço
+// rápido a lê como um inteiro de 32 bits (little-endian): símbolos nos 16 bits
+// baixos, bits consumidos no terceiro byte e quantidade de símbolos no quarto
+typedef struct EntradaTabela
+{
+    unsigned char simbolos[2];
+    unsigned char bits;     // Bits consumidos pelos símbolos da entrada
+    unsigned char quantos;  // Símbolos na entrada (1 ou 2)
+} EntradaTabela;
+
+// Tabelas da decodificação canônica: os códigos de um mesmo comprimento são
+// consecutivos, então basta saber o primeiro código de cada comprimento, quantos
+// existem e onde começam na lista de símbolos em ordem (comprimento, byte)
+typedef struct Decodificador
+{
+    uint32_t primeiro[MAX_COMPRIMENTO + 1];
+    int quantos[MAX_COMPRIMENTO + 1];
+    int inicio[MAX_COMPRIMENTO + 1];
+    unsigned char simbolos[MAX_SIZE];
+    unsigned char comprimentos[MAX_SIZE];
+    EntradaTabela tabela[1 << TABELA_BITS];  // bits = 0: código longo
+} Decodificador;
+
+// Função para ler a tabela de um bloco; retorna o número de bytes consumidos
+size_t lerTabelaBloco(const unsigned char *dados, size_t n, unsigned char comprimentos[MAX_SIZE])
+{
+    if (n < TAMANHO_MAPA)
+    {
+        fprintf(stderr, "Erro: Bloco truncado.\n");
+        exit(-1);
+    }
+    size_t pos = TAMANHO_MAPA;
+    uint64_t kraft = 0;
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        comprimentos[c] = 0;
+        if (dados[c / 8] & (1 << (c % 8)))
+        {
+            if (pos >= n || dados[pos] == 0 || dados[pos] > MAX_COMPRIMENTO)
+            {
+                fprintf(stderr, "Erro: Cabeçalho corrompido.\n");
+                exit(-1);
+            }
+            comprimentos[c] = dados[pos++];
+            kraft += (uint64_t)1 << (MAX_COMPRIMENTO - comprimentos[c]);
+        }
+    }
+    // Comprimentos que pedem mais códigos do que existem (soma de Kraft acima
+    // de 1) sobreporiam entradas e estourariam a tabela de consulta
+    if (kraft > (uint64_t)1 << MAX_COMPRIMENTO)
+    {
+        fprintf(stderr, "Erro: Cabeçalho corrompido.\n");
+        exit(-1);
+    }
+    return pos;
+}
+
+// Função para montar as tabelas canônicas e a tabela de consulta
+void criarDecodificador(Decodificador *d, const unsigned char comprimentos[MAX_SIZE])
+{
+    memset(d, 0, sizeof(Decodificador));
+    memcpy(d->comprimentos, comprimentos, MAX_SIZE);
+    for (int c = 0; c < MAX_SIZE; c++)
+        d->quantos[comprimentos[c]]++;
+    d->quantos[0] = 0;
+
+    uint32_t codigo = 0;
+    int total = 0;
+    for (int comprimento = 1; comprimento <= MAX_COMPRIMENTO; comprimento++)
+    {
+        codigo = (codigo + d->quantos[comprimento - 1]) << 1;
+        d->primeiro[comprimento] = codigo;
+        d->inicio[comprimento] = total;
+        total += d->quantos[comprimento];
+    }
+
+    int posicao[MAX_COMPRIMENTO + 1];
+    memcpy(posicao, d->inicio, sizeof(posicao));
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (comprimentos[c] > 0)
+            d->simbolos[posicao[comprimentos[c]]++] = (unsigned char)c;
+    }
+
+    // Um símbolo por entrada: o código de comprimento L ocupa 2^(TABELA_BITS-L) entradas
+    uint32_t codigos[MAX_SIZE];
+    gerarCodigosCanonicos(comprimentos, codigos);
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        int comprimento = comprimentos[c];
+        if (comprimento == 0 || comprimento > TABELA_BITS)
+            continue;
+        uint32_t primeiraEntrada = codigos[c] << (TABELA_BITS - comprimento);
+        for (uint32_t k = 0; k < (1u << (TABELA_BITS - comprimento)); k++)
+        {
+            EntradaTabela *e = &d->tabela[primeiraEntrada + k];
+            e->simbolos[0] = e->simbolos[1] = (unsigned char)c;
+            e->bits = (unsigned char)comprimento;
+            e->quantos = 1;
+        }
+    }
+
+    // Segundo símbolo: os bits que sobram depois do primeiro, completados com
+    // zeros, indexam a própria tabela; se o código achado couber nas sobras, é real
+    for (uint32_t k = 0; k < (1u << TABELA_BITS); k++)
+    {
+        EntradaTabela *e = &d->tabela[k];
+        if (e->bits == 0)
+            continue;
+        int primeiro = comprimentos[e->simbolos[0]];
+        const EntradaTabela *segundo = &d->tabela[(k << primeiro) & ((1u << TABELA_BITS) - 1)];
+        int comprimentoSegundo = segundo->bits != 0 ? comprimentos[segundo->simbolos[0]] : 0;
+        if (comprimentoSegundo != 0 && comprimentoSegundo <= TABELA_BITS - primeiro)
+        {
+            e->simbolos[1] = segundo->simbolos[0];
+            e->bits = (unsigned char)(primeiro + comprimentoSegundo);
+            e->quantos = 2;
+        }
+    }
+}
+
+// Estrutura de um fluxo sendo lido: a posição é contada em bits desde 'dados'
+typedef struct Fluxo
+{
+    const unsigned char *dados;
+    uint64_t pos;
+    uint64_t limite;     // Bits do fluxo
+    unsigned char *saida;
+    unsigned char *fim;  // Fim da região de saída do fluxo
+} Fluxo;
+
+// Função para ler 57 bits a partir da posição 'pos' (em bits), alinhados à esquerda
+static inline uint64_t espiarBits(const unsigned char *dados, uint64_t pos)
+{
+    uint64_t v;
+    memcpy(&v, dados + (pos >> 3), 8);
+    return __builtin_bswap64(v) << (pos & 7);
+}
+
+// Função para decodificar um código mais longo que a janela (bit a bit)
+static unsigned char decodificarLongo(const Decodificador *d, uint64_t bits, int *comprimento)
+{
+    uint32_t codigo = (uint32_t)(bits >> (64 - TABELA_BITS));
+    for (int l = TABELA_BITS + 1; l <= MAX_COMPRIMENTO; l++)
+    {
+        codigo = (codigo << 1) | (uint32_t)((bits >> (64 - l)) & 1);
+        if (codigo - d->primeiro[l] < (uint32_t)d->quantos[l])
+        {
+            *comprimento = l;
+            return d->simbolos[d->inicio[l] + codigo - d->primeiro[l]];
+        }
+    }
+    fprintf(stderr, "Erro: Dados corrompidos.\n");
+    exit(-1);
+}
+
+// Função para decodificar um símbolo do fluxo pelo caminho geral (com verificação)
+static void decodificarSimbolo(const Decodificador *d, Fluxo *f)
+{
+    if (f->pos >= f->limite)
+    {
+        fprintf(stderr, "Erro: Dados corrompidos.\n");
+        exit(-1);
+    }
+    uint64_t bits = espiarBits(f->dados, f->pos);
+    EntradaTabela e = d->tabela[bits >> (64 - TABELA_BITS)];
+    int comprimento = d->comprimentos[e.simbolos[0]];
+    *f->saida++ = e.bits != 0 ? e.simbolos[0] : decodificarLongo(d, bits, &comprimento);
+    f->pos += comprimento;
+}
+
+// Um passo do laço rápido no fluxo j: uma consulta, até dois símbolos (sempre
+// grava dois bytes). Os bits já lidos saem do registro 'bits##j' por um
+// deslocamento. Um código longo sai do laço sem consumir nada
+#define PASSO_FLUXO(j)                                                          \
+    do                                                                          \
+    {                                                                           \
+        uint32_t e;                                                             \
+        memcpy(&e, &tabela[bits##j >> (64 - TABELA_BITS)], 4);                  \
+        unsigned consumidos = (e >> 16) & 0xff;                                 \
+        if (__builtin_expect(consumidos == 0, 0))                               \
+        {                                                                       \
+            longo = j;                                                          \
+            goto sair;                                                          \
+        }                                                                       \
+        memcpy(saida##j, &e, 2);                                                \
+        saida##j += e >> 24;                                                    \
+        bits##j <<= consumidos;                                                 \
+        pos##j += consumidos;                                                   \
+    } while (0)
+
+// Uma rodada: uma consulta em cada fluxo; são 4 rodadas por leitura de 57 bits
+#define RODADA()                                                                \
+    do                                                                          \
+    {                                                                           \
+        PASSO_FLUXO(0);                                                         \
+        PASSO_FLUXO(1);                                                         \
+        PASSO_FLUXO(2);                                                         \
+        PASSO_FLUXO(3);                                                         \
+    } while (0)
+
+// Função para decodificar os fluxos em 'destino'
+// O laço rápido avança os quatro fluxos juntos enquanto todos têm folga: pelo
+// menos 8 bytes de saída e 4 códigos máximos antes do fim dos bits. A cada
+// volta, cada fluxo lê 57 bits de uma vez e faz 4 consultas (até 44 bits) com
+// eles; as quatro cadeias de dependência são independentes e se sobrepõem no
+// processador. Para caber nos registradores, o estado fica em variáveis locais
+// com nome (em vetores ou estruturas, as gravações de bytes na saída obrigariam
+// o compilador a relê-lo da memória), as posições são contadas a partir do
+// início do primeiro fluxo e nenhuma função é chamada dentro do laço: um
+// código longo sai dele, é decodificado à parte e o laço recomeça
+void decodificarFluxos(const Decodificador *d, Fluxo fluxos[NUM_FLUXOS])
+{
+    const EntradaTabela *tabela = d->tabela;
+    const unsigned char *base = fluxos[0].dados;
+    uint64_t deslocamento[NUM_FLUXOS];
+    for (int j = 0; j < NUM_FLUXOS; j++)
+        deslocamento[j] = 8 * (uint64_t)(fluxos[j].dados - base);
+
+    for (;;)
+    {
+        int rapido = 1;
+        uint64_t limite[NUM_FLUXOS];
+        unsigned char *fim[NUM_FLUXOS];
+        for (int j = 0; j < NUM_FLUXOS; j++)
+        {
+            rapido &= fluxos[j].fim - fluxos[j].saida >= 8 && fluxos[j].limite - fluxos[j].pos >= 4 * MAX_COMPRIMENTO;
+            limite[j] = deslocamento[j] + fluxos[j].limite - 4 * MAX_COMPRIMENTO;
+            fim[j] = fluxos[j].fim - 8;
+        }
+        if (!rapido)
+            break;
+
+        int longo = -1;
+        uint64_t pos0 = deslocamento[0] + fluxos[0].pos, pos1 = deslocamento[1] + fluxos[1].pos;
+        uint64_t pos2 = deslocamento[2] + fluxos[2].pos, pos3 = deslocamento[3] + fluxos[3].pos;
+        unsigned char *saida0 = fluxos[0].saida, *saida1 = fluxos[1].saida;
+        unsigned char *saida2 = fluxos[2].saida, *saida3 = fluxos[3].saida;
+        uint64_t bits0, bits1, bits2, bits3;
+
+        while ((saida0 <= fim[0]) & (saida1 <= fim[1]) & (saida2 <= fim[2]) & (saida3 <= fim[3]) &
+               (pos0 <= limite[0]) & (pos1 <= limite[1]) & (pos2 <= limite[2]) & (pos3 <= limite[3]))
+        {
+            bits0 = espiarBits(base, pos0);
+            bits1 = espiarBits(base, pos1);
+            bits2 = espiarBits(base, pos2);
+            bits3 = espiarBits(base, pos3);
+            RODADA();
+            RODADA();
+            RODADA();
+            RODADA();
+        }
+    sair:
+        fluxos[0].pos = pos0 - deslocamento[0], fluxos[0].saida = saida0;
+        fluxos[1].pos = pos1 - deslocamento[1], fluxos[1].saida = saida1;
+        fluxos[2].pos = pos2 - deslocamento[2], fluxos[2].saida = saida2;
+        fluxos[3].pos = pos3 - deslocamento[3], fluxos[3].saida = saida3;
+        if (longo < 0)
+            break;
+        decodificarSimbolo(d, &fluxos[longo]);
+    }
+
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        while (fluxos[j].saida < fluxos[j].fim)
+            decodificarSimbolo(d, &fluxos[j]);
+        if (fluxos[j].pos > fluxos[j].limite)
+        {
+            fprintf(stderr, "Erro: Dados corrompidos.\n");
+            exit(-1);
+        }
+    }
+}
+#undef PASSO_FLUXO
+#undef RODADA
+
+// Função para descomprimir um bloco de 'n' bytes em 'destino' ('tamanho' bytes originais)
+void descomprimirBloco(const unsigned char *dados, size_t n, unsigned char *destino, size_t tamanho)
+{
+    unsigned char comprimentos[MAX_SIZE];
+    Decodificador d;
+
+    size_t pos = lerTabelaBloco(dados, n, comprimentos);
+    criarDecodificador(&d, comprimentos);
+
+    uint64_t bytesFluxo[NUM_FLUXOS], total = 0;
+    if (n - pos < 4 * NUM_FLUXOS)
+    {
+        fprintf(stderr, "Erro: Bloco truncado.\n");
+        exit(-1);
+    }
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        bytesFluxo[j] = lerInteiro(dados + pos, 4);
+        pos += 4;
+        total += bytesFluxo[j];
+    }
+    if (total > n - pos || n - pos - total < PREENCHIMENTO)
+    {
+        fprintf(stderr, "Erro: Bloco truncado.\n");
+        exit(-1);
+    }
+
+    Fluxo fluxos[NUM_FLUXOS];
+    for (int j = 0; j < NUM_FLUXOS; j++)
+    {
+        fluxos[j].dados = dados + pos;
+        fluxos[j].pos = 0;
+        fluxos[j].limite = 8 * bytesFluxo[j];
+        fluxos[j].saida = destino + inicioPedaco(tamanho, j);
+        fluxos[j].fim = destino + inicioPedaco(tamanho, j + 1);
+        pos += bytesFluxo[j];
+    }
+    decodificarFluxos(&d, fluxos);
+}
+
+// ---------------------------------------------------------------------------
+// Blocos em paralelo
+// ---------------------------------------------------------------------------
+
+// Os blocos são independentes: um grupo de trabalhadores pega o próximo bloco
+// livre e o processa numa das vagas de uma janela circular, enquanto a thread
+// principal entrega os resultados em ordem. Um trabalhador só pega um bloco se
+// ele estiver a menos de 'janela' blocos do próximo a ser entregue, então a
+// memória usada é limitada mesmo com um bloco lento segurando a fila.
+
+// Estrutura do grupo de trabalhadores
+typedef struct PoolBlocos
+{
+    long total;      // Número de blocos
+    long proximo;    // Próximo bloco a ser pego por um trabalhador
+    long entregue;   // Blocos já entregues em ordem
+    int janela;
+    int *pronto;     // pronto[i % janela]: o bloco i terminou
+    Saida **vagas;   // Resultado de cada vaga (saídas em memória)
+    void (*processar)(void *contexto, long i, Saida *resultado);
+    void *contexto;
+    pthread_mutex_t trava;
+    pthread_cond_t sinal;
+} PoolBlocos;
+
+void *trabalhadorBlocos(void *arg)
+{
+    PoolBlocos *pool = (PoolBlocos *)arg;
+    pthread_mutex_lock(&pool->trava);
+    for (;;)
+    {
+        while (pool->proximo < pool->total && pool->proximo >= pool->entregue + pool->janela)
+            pthread_cond_wait(&pool->sinal, &pool->trava);
+        if (pool->proximo >= pool->total)
+            break;
+        long i = pool->proximo++;
+        pthread_mutex_unlock(&pool->trava);
+
+        pool->processar(pool->contexto, i, pool->vagas[i % pool->janela]);
+
+        pthread_mutex_lock(&pool->trava);
+        pool->pronto[i % pool->janela] = 1;
+        pthread_cond_broadcast(&pool->sinal);
+    }
+    pthread_mutex_unlock(&pool->trava);
+    return NULL;
+}
+
+// Função para processar 'total' blocos com 'numThreads' trabalhadores
+// 'entregar' é chamada na thread principal, na ordem dos blocos
+void executarBlocos(long total, int numThreads, void (*processar)(void *, long, Saida *),
+                    void (*entregar)(void *, long, Saida *), void *contexto)
+{
+    if (numThreads < 1)
+        numThreads = 1;
+    PoolBlocos pool;
+    pool.total = total;
+    pool.proximo = pool.entregue = 0;
+    pool.janela = 2 * numThreads;
+    pool.pronto = (int *)calloc(pool.janela, sizeof(int));
+    pool.vagas = (Saida **)malloc(pool.janela * sizeof(Saida *));
+    pthread_t *ids = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (pool.pronto == NULL || pool.vagas == NULL || ids == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    for (int v = 0; v < pool.janela; v++)
+        pool.vagas[v] = (Saida *)calloc(1, sizeof(Saida));
+    pool.processar = processar;
+    pool.contexto = contexto;
+    pthread_mutex_init(&pool.trava, NULL);
+    pthread_cond_init(&pool.sinal, NULL);
+
+    // Só as threads que de fato subiram entram no join; sem nenhuma, ninguém
+    // encheria as vagas e a espera abaixo nunca terminaria
+    int iniciadas = 0;
+    for (int t = 0; t < numThreads; t++)
+    {
+        if (pthread_create(&ids[iniciadas], NULL, trabalhadorBlocos, &pool) == 0)
+            iniciadas++;
+    }
+    if (iniciadas == 0)
+    {
+        fprintf(stderr, "Erro: Não foi possível criar as threads.\n");
+        exit(-1);
+    }
+
+    for (long i = 0; i < total; i++)
+    {
+        int vaga = (int)(i % pool.janela);
+        pthread_mutex_lock(&pool.trava);
+        while (!pool.pronto[vaga])
+            pthread_cond_wait(&pool.sinal, &pool.trava);
+        pthread_mutex_unlock(&pool.trava);
+
+        entregar(contexto, i, pool.vagas[vaga]);
+        pool.vagas[vaga]->tamanho = 0;
+
+        pthread_mutex_lock(&pool.trava);
+        pool.pronto[vaga] = 0;
+        pool.entregue++;
+        pthread_cond_broadcast(&pool.sinal);
+        pthread_mutex_unlock(&pool.trava);
+    }
+
+    for (int t = 0; t < iniciadas; t++)
+        pthread_join(ids[t], NULL);
+    pthread_mutex_destroy(&pool.trava);
+    pthread_cond_destroy(&pool.sinal);
+    for (int v = 0; v < pool.janela; v++)
+    {
+        free(pool.vagas[v]->memoria);
+        free(pool.vagas[v]);
+    }
+    free(pool.vagas);
+    free(pool.pronto);
+    free(ids);
+}
+
+// Contexto da compressão: a entrada, a saída final e o índice sendo montado
+typedef struct TrabalhoCompressao
+{
+    const unsigned char *dados;
+    size_t n;
+    size_t tamanhoBloco;
+    int limite;        // Maior comprimento de código
+    Saida *saida;
+    uint32_t *indice;  // Bytes comprimidos de cada bloco
+} TrabalhoCompressao;
+
+void processarCompressao(void *contexto, long i, Saida *resultado)
+{
+    TrabalhoCompressao *t = (TrabalhoCompressao *)contexto;
+    size_t inicio = (size_t)i * t->tamanhoBloco;
+    size_t fim = inicio + t->tamanhoBloco < t->n ? inicio + t->tamanhoBloco : t->n;
+    comprimirBloco(t->dados + inicio, fim - inicio, resultado, t->limite);
+}
+
+void entregarCompressao(void *contexto, long i, Saida *resultado)
+{
+    TrabalhoCompressao *t = (TrabalhoCompressao *)contexto;
+    escreverBytes(t->saida, resultado->memoria, resultado->tamanho);
+    t->indice[i] = (uint32_t)resultado->tamanho;
+}
+
+// Função para comprimir 'n' bytes em blocos de 'tamanhoBloco' com 'numThreads' trabalhadores
+// e códigos de no máximo 'limite' bits (de 8 a MAX_COMPRIMENTO)
+// Formato: cabeçalho, blocos em ordem e, no fim, o índice com o tamanho
+// comprimido de cada bloco (4 bytes cada). O índice vai no fim para a saída
+// poder ser gravada em sequência, inclusive num pipe
+void comprimir(const unsigned char *dados, size_t n, Saida *saida, int numThreads, size_t tamanhoBloco, int limite)
+{
+    if (tamanhoBloco < 1 || tamanhoBloco > BLOCO_MAXIMO)
+    {
+        fprintf(stderr, "Erro: Tamanho de bloco inválido.\n");
+        exit(-1);
+    }
+    if (limite < 8 || limite > MAX_COMPRIMENTO)
+    {
+        fprintf(stderr, "Erro: Limite de comprimento inválido.\n");
+        exit(-1);
+    }
+    long total = (long)((n + tamanhoBloco - 1) / tamanhoBloco);
+    TrabalhoCompressao t = {dados, n, tamanhoBloco, limite, saida, (uint32_t *)malloc((total + 1) * sizeof(uint32_t))};
+    if (t.indice == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    unsigned char cabecalho[TAMANHO_CABECALHO] = {'H', 'U', 'F', '3'};
+    for (int i = 0; i < 8; i++)
+        cabecalho[4 + i] = (unsigned char)((uint64_t)n >> (8 * i));
+    for (int i = 0; i < 4; i++)
+        cabecalho[12 + i] = (unsigned char)(tamanhoBloco >> (8 * i));
+    escreverBytes(saida, cabecalho, TAMANHO_CABECALHO);
+
+    executarBlocos(total, numThreads, processarCompressao, entregarCompressao, &t);
+
+    for (long i = 0; i < total; i++)
+        escreverU32(saida, t.indice[i]);
+    esvaziarSaida(saida);
+    free(t.indice);
+}
+
+// Contexto da descompressão
+typedef struct TrabalhoDescompressao
+{
+    const unsigned char *dados;
+    const uint64_t *inicios;  // Posição de cada bloco na entrada (total + 1 posições)
+    uint64_t tamanho;         // Tamanho original
+    size_t tamanhoBloco;
+    unsigned char *destino;   // Saída em memória (NULL: cada bloco vai para a sua vaga)
+    Saida *saida;
+} TrabalhoDescompressao;
+
+void processarDescompressao(void *contexto, long i, Saida *resultado)
+{
+    TrabalhoDescompressao *t = (TrabalhoDescompressao *)contexto;
+    uint64_t inicio = (uint64_t)i * t->tamanhoBloco;
+    size_t tamanho = (size_t)(inicio + t->tamanhoBloco < t->tamanho ? t->tamanhoBloco : t->tamanho - inicio);
+    unsigned char *destino = t->destino != NULL ? t->destino + inicio : NULL;
+    if (destino == NULL)
+    {
+        if (resultado->capacidade < tamanho)
+        {
+            free(resultado->memoria);
+            resultado->capacidade = tamanho;
+            resultado->memoria = (unsigned char *)malloc(tamanho);
+            if (resultado->memoria == NULL)
+            {
+                fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+                exit(-1);
+            }
+        }
+        destino = resultado->memoria;
+        resultado->tamanho = tamanho;
+    }
+    descomprimirBloco(t->dados + t->inicios[i], t->inicios[i + 1] - t->inicios[i], destino, tamanho);
+}
+
+void entregarDescompressao(void *contexto, long i, Saida *resultado)
+{
+    TrabalhoDescompressao *t = (TrabalhoDescompressao *)contexto;
+    (void)i;
+    if (t->destino == NULL &&
+        fwrite(resultado->memoria, 1, resultado->tamanho, t->saida->arquivo) != resultado->tamanho)
+    {
+        fprintf(stderr, "Erro: Falha na gravação.\n");
+        exit(-1);
+    }
+}
+
+// Função para descomprimir com 'numThreads' trabalhadores; retorna o tamanho original
+// Numa saída em memória cada bloco é decodificado direto no seu lugar; num
+// arquivo, os blocos passam pelas vagas e são gravados em ordem
+uint64_t descomprimir(const unsigned char *dados, size_t n, Saida *saida, int numThreads)
+{
+    if (n < TAMANHO_CABECALHO || memcmp(dados, "HUF3", 4) != 0)
+    {
+        fprintf(stderr, "Erro: Entrada não é um arquivo Huffman.\n");
+        exit(-1);
+    }
+    TrabalhoDescompressao t;
+    t.dados = dados;
+    t.tamanho = lerInteiro(dados + 4, 8);
+    t.tamanhoBloco = (size_t)lerInteiro(dados + 12, 4);
+    t.saida = saida;
+    if (t.tamanhoBloco < 1 || t.tamanhoBloco > BLOCO_MAXIMO)
+    {
+        fprintf(stderr, "Erro: Cabeçalho corrompido.\n");
+        exit(-1);
+    }
+
+    // O índice está no fim; as posições dos blocos são as somas dos tamanhos
+    uint64_t total = (t.tamanho + t.tamanhoBloco - 1) / t.tamanhoBloco;
+    if (total > (n - TAMANHO_CABECALHO) / 4)
+    {
+        fprintf(stderr, "Erro: Entrada truncada.\n");
+        exit(-1);
+    }
+    const unsigned char *indice = dados + n - 4 * total;
+    uint64_t *inicios = (uint64_t *)malloc((total + 1) * sizeof(uint64_t));
+    if (inicios == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    inicios[0] = TAMANHO_CABECALHO;
+    for (uint64_t i = 0; i < total; i++)
+        inicios[i + 1] = inicios[i] + lerInteiro(indice + 4 * i, 4);
+    if (inicios[total] != n - 4 * total)
+    {
+        fprintf(stderr, "Erro: Índice de blocos corrompido.\n");
+        exit(-1);
+    }
+    t.inicios = inicios;
+
+    esvaziarSaida(saida);
+    t.destino = NULL;
+    if (saida->arquivo == NULL)
+    {
+        if (saida->memoria == NULL || saida->tamanho + t.tamanho > saida->capacidade)
+        {
+            saida->capacidade = saida->tamanho + t.tamanho + 1;
+            saida->memoria = (unsigned char *)realloc(saida->memoria, saida->capacidade);
+            if (saida->memoria == NULL)
+            {
+                fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+                exit(-1);
+            }
+        }
+        t.destino = saida->memoria + saida->tamanho;
+    }
+
+    executarBlocos((long)total, numThreads, processarDescompressao, entregarDescompressao, &t);
+
+    if (saida->arquivo == NULL)
+        saida->tamanho += t.tamanho;
+    free(inicios);
+    return t.tamanho;
+}
+
+// ---------------------------------------------------------------------------
+// Modo adaptativo (fluxos ao vivo)
+// ---------------------------------------------------------------------------
+
+// A compressão em blocos precisa do bloco inteiro antes de contar as
+// frequências. O modo adaptativo não: codificador e decodificador atualizam o
+// mesmo modelo a cada símbolo, então nada do modelo vai no arquivo. Há dois
+// modelos:
+// - FGK: árvore de Huffman dinâmica (Faller, Gallager e Knuth), atualizada a
+//   cada símbolo. Um byte ainda não visto sai como o código do nó NYT seguido
+//   dos seus 8 bits.
+// - Periódico: códigos canônicos refeitos a cada 'periodo' bytes a partir das
+//   contagens até ali (divididas por 2 a cada vez, para seguir mudanças). É bem
+//   mais barato: entre as reconstruções a codificação é a dos blocos.
+//
+// Formato: "HUFA" (FGK) ou "HUFP" e o período em bytes (4 bytes); depois,
+// quadros com a quantidade de símbolos (4 bytes), os bytes de dados (4 bytes) e
+// os dados. Um quadro com 0 símbolos encerra o fluxo. Cada leitura da entrada
+// vira um quadro gravado na hora, e o decodificador grava a saída de cada
+// quadro antes de esperar o próximo: a latência fica limitada a uma leitura e
+// a memória a um quadro de até QUADRO_MAXIMO símbolos.
+
+#define QUADRO_MAXIMO (1 << 16)
+#define PERIODO_PADRAO (16 << 10)
+#define LIMITE_PERIODICO 15
+#define NOS_FGK (2 * MAX_SIZE + 1)  // 256 folhas, o NYT e os nós internos
+#define RAIZ_FGK (NOS_FGK - 1)
+#define SEM_NO -1
+// Maior código FGK: um caminho de até MAX_SIZE bits e o byte literal
+#define BYTES_QUADRO_MAXIMO ((size_t)QUADRO_MAXIMO * (MAX_SIZE + 8) / 8 + 1)
+
+// Estrutura da árvore FGK. Os nós ficam no vetor na ordem da propriedade dos
+// irmãos: pesos não decrescentes com o índice e irmãos vizinhos. A raiz é o
+// último nó, e cada símbolo novo divide o NYT em dois nós de índices menores
+typedef struct ArvoreFGK
+{
+    uint64_t peso[NOS_FGK];
+    int pai[NOS_FGK];
+    int esquerda[NOS_FGK];  // SEM_NO: folha
+    int direita[NOS_FGK];
+    int simbolo[NOS_FGK];   // SEM_NO: nó interno ou NYT
+    int folha[MAX_SIZE];    // Nó de cada byte (SEM_NO: ainda não visto)
+    int nyt;
+} ArvoreFGK;
+
+void iniciarFGK(ArvoreFGK *a)
+{
+    a->nyt = RAIZ_FGK;
+    a->peso[RAIZ_FGK] = 0;
+    a->pai[RAIZ_FGK] = a->esquerda[RAIZ_FGK] = a->direita[RAIZ_FGK] = a->simbolo[RAIZ_FGK] = SEM_NO;
+    for (int c = 0; c < MAX_SIZE; c++)
+        a->folha[c] = SEM_NO;
+}
+
+// Função para trocar de lugar as subárvores dos nós 'x' e 'y'
+// Os pesos são iguais; o que muda de posição são os filhos ou o símbolo
+void trocarNosFGK(ArvoreFGK *a, int x, int y)
+{
+    int temp = a->esquerda[x];
+    a->esquerda[x] = a->esquerda[y];
+    a->esquerda[y] = temp;
+    temp = a->direita[x];
+    a->direita[x] = a->direita[y];
+    a->direita[y] = temp;
+    temp = a->simbolo[x];
+    a->simbolo[x] = a->simbolo[y];
+    a->simbolo[y] = temp;
+
+    int nos[2] = {x, y};
+    for (int i = 0; i < 2; i++)
+    {
+        int no = nos[i];
+        if (a->esquerda[no] != SEM_NO)
+            a->pai[a->esquerda[no]] = a->pai[a->direita[no]] = no;
+        else if (a->simbolo[no] != SEM_NO)
+            a->folha[a->simbolo[no]] = no;
+        else
+            a->nyt = no;
+    }
+}
+
+// Função para contar mais uma ocorrência de 'c' e manter a propriedade dos irmãos
+// Subindo da folha, cada nó troca de lugar com o último do seu bloco de mesmo
+// peso (exceto o próprio pai) antes de ganhar 1, e o caminho segue pelo novo pai
+void atualizarFGK(ArvoreFGK *a, unsigned char c)
+{
+    int q = a->folha[c];
+    if (q == SEM_NO)
+    {
+        // O NYT vira um nó interno com o novo NYT à esquerda e a folha à direita
+        int k = a->nyt;
+        a->esquerda[k] = k - 2;
+        a->direita[k] = k - 1;
+        a->peso[k - 1] = a->peso[k - 2] = 0;
+        a->pai[k - 1] = a->pai[k - 2] = k;
+        a->esquerda[k - 1] = a->direita[k - 1] = a->esquerda[k - 2] = a->direita[k - 2] = SEM_NO;
+        a->simbolo[k - 1] = c;
+        a->simbolo[k - 2] = SEM_NO;
+        a->folha[c] = q = k - 1;
+        a->nyt = k - 2;
+    }
+    while (q != SEM_NO)
+    {
+        int lider = q;
+        while (lider < RAIZ_FGK && a->peso[lider + 1] == a->peso[q])
+            lider++;
+        if (lider != q && lider != a->pai[q])
+        {
+            trocarNosFGK(a, q, lider);
+            q = lider;
+        }
+        a->peso[q]++;
+        q = a->pai[q];
+    }
+}
+
+// Estrutura do modelo periódico
+typedef struct ModeloPeriodico
+{
+    uint64_t contagens[MAX_SIZE];
+    unsigned char comprimentos[MAX_SIZE];
+    uint32_t codigos[MAX_SIZE];
+    Decodificador *d;  // Só no decodificador
+    size_t periodo;
+    size_t restantes;  // Símbolos até a próxima reconstrução
+} ModeloPeriodico;
+
+// Função para refazer os códigos a partir das contagens; as contagens caem à
+// metade para pesar mais o recente. Todo byte precisa de um código, mesmo os
+// nunca vistos: eles entram com peso 1 contra 256 por ocorrência e limite de
+// LIMITE_PERIODICO bits, para ocuparem pouco do espaço de códigos
+void reconstruirPeriodico(ModeloPeriodico *m)
+{
+    uint64_t frequencias[MAX_SIZE];
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        frequencias[c] = (m->contagens[c] << 8) + 1;
+        m->contagens[c] >>= 1;
+    }
+    comprimentosHuffman(frequencias, m->comprimentos, LIMITE_PERIODICO);
+    gerarCodigosCanonicos(m->comprimentos, m->codigos);
+    if (m->d != NULL)
+        criarDecodificador(m->d, m->comprimentos);
+    m->restantes = m->periodo;
+}
+
+// Função para somar às contagens os bytes de um trecho
+void contarPeriodico(ModeloPeriodico *m, const unsigned char *dados, size_t n)
+{
+    uint64_t frequencias[MAX_SIZE];
+    contarFrequencias(dados, n, frequencias);
+    for (int c = 0; c < MAX_SIZE; c++)
+        m->contagens[c] += frequencias[c];
+}
+
+// Estado de um dos lados (codificador ou decodificador) do modo adaptativo
+typedef struct Adaptativo
+{
+    size_t periodo;  // 0: FGK
+    ArvoreFGK fgk;
+    ModeloPeriodico periodico;
+} Adaptativo;
+
+// Função para criar o estado; 'periodo' 0 escolhe o FGK
+Adaptativo *criarAdaptativo(size_t periodo, int decodificar)
+{
+    Adaptativo *a = (Adaptativo *)calloc(1, sizeof(Adaptativo));
+    if (a != NULL && decodificar && periodo > 0)
+        a->periodico.d = (Decodificador *)malloc(sizeof(Decodificador));
+    if (a == NULL || (decodificar && periodo > 0 && a->periodico.d == NULL))
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    a->periodo = periodo;
+    if (periodo == 0)
+        iniciarFGK(&a->fgk);
+    else
+    {
+        a->periodico.periodo = periodo;
+        reconstruirPeriodico(&a->periodico);
+    }
+    return a;
+}
+
+void liberarAdaptativo(Adaptativo *a)
+{
+    free(a->periodico.d);
+    free(a);
+}
+
+// Função para codificar um quadro; os dados vão para 'saida', completados até o byte
+void codificarQuadro(Adaptativo *a, const unsigned char *dados, size_t n, Saida *saida)
+{
+    if (a->periodo > 0)
+    {
+        // Cada trecho entre reconstruções é um fluxo de bits completado até o byte
+        ModeloPeriodico *m = &a->periodico;
+        while (n > 0)
+        {
+            size_t trecho = n < m->restantes ? n : m->restantes;
+            codificarFluxo(dados, trecho, m->comprimentos, m->codigos, saida);
+            contarPeriodico(m, dados, trecho);
+            dados += trecho;
+            n -= trecho;
+            m->restantes -= trecho;
+            if (m->restantes == 0)
+                reconstruirPeriodico(m);
+        }
+        return;
+    }
+
+    // FGK: o caminho da folha até a raiz sai ao contrário, do topo para baixo
+    ArvoreFGK *arvore = &a->fgk;
+    unsigned char caminho[MAX_SIZE + 1];
+    uint64_t bits = 0;
+    int contagem = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned char c = dados[i];
+        int no = arvore->folha[c] != SEM_NO ? arvore->folha[c] : arvore->nyt, profundidade = 0;
+        for (; no != RAIZ_FGK; no = arvore->pai[no])
+            caminho[profundidade++] = arvore->direita[arvore->pai[no]] == no;
+        while (profundidade > 0)
+        {
+            bits = (bits << 1) | caminho[--profundidade];
+            if (++contagem == 8)
+            {
+                escreverByte(saida, (unsigned char)bits);
+                contagem = 0;
+            }
+        }
+        if (arvore->folha[c] == SEM_NO)
+        {
+            bits = (bits << 8) | c;
+            escreverByte(saida, (unsigned char)(bits >> contagem));
+        }
+        atualizarFGK(arvore, c);
+    }
+    if (contagem > 0)
+        escreverByte(saida, (unsigned char)(bits << (8 - contagem)));
+}
+
+// Função para decodificar um quadro de 'n' símbolos a partir de 'bytes' bytes de dados
+// Os dados precisam de PREENCHIMENTO bytes legíveis depois do fim
+void decodificarQuadro(Adaptativo *a, const unsigned char *dados, size_t bytes, unsigned char *destino, size_t n)
+{
+    uint64_t pos = 0, limite = 8 * (uint64_t)bytes;
+    if (a->periodo > 0)
+    {
+        ModeloPeriodico *m = &a->periodico;
+        while (n > 0)
+        {
+            size_t trecho = n < m->restantes ? n : m->restantes;
+            Fluxo f = {dados, pos, limite, destino, destino + trecho};
+            const Decodificador *d = m->d;
+
+            // Até dois símbolos por consulta enquanto a janela inteira cabe nos dados
+            while (f.fim - f.saida >= 2 && f.pos + 64 <= limite)
+            {
+                EntradaTabela e = d->tabela[espiarBits(f.dados, f.pos) >> (64 - TABELA_BITS)];
+                if (e.bits == 0)
+                {
+                    decodificarSimbolo(d, &f);
+                    continue;
+                }
+                f.saida[0] = e.simbolos[0];
+                f.saida[1] = e.simbolos[1];
+                f.saida += e.quantos;
+                f.pos += e.bits;
+            }
+            while (f.saida < f.fim)
+                decodificarSimbolo(d, &f);
+            if (f.pos > limite)
+            {
+                fprintf(stderr, "Erro: Dados corrompidos.\n");
+                exit(-1);
+            }
+            pos = (f.pos + 7) & ~(uint64_t)7;
+            contarPeriodico(m, destino, trecho);
+            destino += trecho;
+            n -= trecho;
+            m->restantes -= trecho;
+            if (m->restantes == 0)
+                reconstruirPeriodico(m);
+        }
+        return;
+    }
+
+    ArvoreFGK *arvore = &a->fgk;
+    for (size_t i = 0; i < n; i++)
+    {
+        int no = RAIZ_FGK;
+        while (arvore->esquerda[no] != SEM_NO && pos < limite)
+        {
+            no = (dados[pos >> 3] >> (7 - (pos & 7))) & 1 ? arvore->direita[no] : arvore->esquerda[no];
+            pos++;
+        }
+        if (arvore->esquerda[no] != SEM_NO || (no == arvore->nyt && pos + 8 > limite))
+        {
+            fprintf(stderr, "Erro: Dados corrompidos.\n");
+            exit(-1);
+        }
+        unsigned char c;
+        if (no == arvore->nyt)
+        {
+            c = (unsigned char)(espiarBits(dados, pos) >> 56);
+            pos += 8;
+        }
+        else
+            c = (unsigned char)arvore->simbolo[no];
+        destino[i] = c;
+        atualizarFGK(arvore, c);
+    }
+}
+
+// Função para gravar um inteiro de 4 bytes direto num arquivo
+void gravarU32(FILE *arquivo, uint32_t valor)
+{
+    unsigned char bytes[4] = {(unsigned char)valor, (unsigned char)(valor >> 8), (unsigned char)(valor >> 16),
+                              (unsigned char)(valor >> 24)};
+    if (fwrite(bytes, 1, 4, arquivo) != 4)
+    {
+        fprintf(stderr, "Erro: Falha na gravação.\n");
+        exit(-1);
+    }
+}
+
+// Função para comprimir um fluxo no modo adaptativo ('periodo' 0: FGK)
+// A entrada é lida com read(), que devolve o que já chegou num pipe ou socket
+// sem esperar o buffer encher; cada leitura sai na hora como um quadro
+void comprimirAdaptativo(int entrada, FILE *arquivo, size_t periodo)
+{
+    unsigned char *buffer = (unsigned char *)malloc(QUADRO_MAXIMO);
+    Saida *quadro = (Saida *)calloc(1, sizeof(Saida));
+    Adaptativo *a = criarAdaptativo(periodo, 0);
+    if (buffer == NULL || quadro == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    if (fwrite(periodo > 0 ? "HUFP" : "HUFA", 1, 4, arquivo) != 4)
+    {
+        fprintf(stderr, "Erro: Falha na gravação.\n");
+        exit(-1);
+    }
+    if (periodo > 0)
+        gravarU32(arquivo, (uint32_t)periodo);
+    for (;;)
+    {
+        ssize_t lidos = read(entrada, buffer, QUADRO_MAXIMO);
+        if (lidos < 0 && errno == EINTR)
+            continue;
+        if (lidos < 0)
+        {
+            fprintf(stderr, "Erro: Falha na leitura.\n");
+            exit(-1);
+        }
+        quadro->tamanho = 0;
+        codificarQuadro(a, buffer, (size_t)lidos, quadro);
+        esvaziarSaida(quadro);
+        gravarU32(arquivo, (uint32_t)lidos);
+        gravarU32(arquivo, (uint32_t)quadro->tamanho);
+        // O quadro final (lidos == 0) não tem corpo: quadro->memoria pode ser NULL
+        if ((quadro->tamanho > 0 && fwrite(quadro->memoria, 1, quadro->tamanho, arquivo) != quadro->tamanho) ||
+            fflush(arquivo) != 0)
+        {
+            fprintf(stderr, "Erro: Falha na gravação.\n");
+            exit(-1);
+        }
+        if (lidos == 0)
+            break;
+    }
+
+    liberarAdaptativo(a);
+    free(quadro->memoria);
+    free(quadro);
+    free(buffer);
+}
+
+// Função para ler exatamente 'n' bytes de um arquivo
+void lerExato(FILE *arquivo, unsigned char *destino, size_t n)
+{
+    if (fread(destino, 1, n, arquivo) != n)
+    {
+        fprintf(stderr, "Erro: Entrada truncada.\n");
+        exit(-1);
+    }
+}
+
+// Função para reconhecer a assinatura de um fluxo adaptativo
+int ehAdaptativo(const unsigned char assinatura[4])
+{
+    return memcmp(assinatura, "HUFA", 4) == 0 || memcmp(assinatura, "HUFP", 4) == 0;
+}
+
+// Função para descomprimir um fluxo adaptativo cuja assinatura já foi lida
+// Cada leitura pede só os bytes que o quadro anuncia, então nunca espera por
+// dados que o codificador ainda não mandou
+void descomprimirAdaptativo(FILE *entrada, const unsigned char assinatura[4], FILE *arquivo)
+{
+    unsigned char cabecalho[8];
+    size_t periodo = 0;
+    if (assinatura[3] == 'P')
+    {
+        lerExato(entrada, cabecalho, 4);
+        periodo = (size_t)lerInteiro(cabecalho, 4);
+        if (periodo == 0)
+        {
+            fprintf(stderr, "Erro: Cabeçalho corrompido.\n");
+            exit(-1);
+        }
+    }
+    Adaptativo *a = criarAdaptativo(periodo, 1);
+    unsigned char *dados = (unsigned char *)malloc(BYTES_QUADRO_MAXIMO + PREENCHIMENTO);
+    unsigned char *destino = (unsigned char *)malloc(QUADRO_MAXIMO);
+    if (dados == NULL || destino == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    for (;;)
+    {
+        lerExato(entrada, cabecalho, 8);
+        size_t n = (size_t)lerInteiro(cabecalho, 4), bytes = (size_t)lerInteiro(cabecalho + 4, 4);
+        if (n > QUADRO_MAXIMO || bytes > BYTES_QUADRO_MAXIMO)
+        {
+            fprintf(stderr, "Erro: Quadro corrompido.\n");
+            exit(-1);
+        }
+        if (n == 0)
+            break;
+        lerExato(entrada, dados, bytes);
+        memset(dados + bytes, 0, PREENCHIMENTO);
+        decodificarQuadro(a, dados, bytes, destino, n);
+        if (fwrite(destino, 1, n, arquivo) != n || fflush(arquivo) != 0)
+        {
+            fprintf(stderr, "Erro: Falha na gravação.\n");
+            exit(-1);
+        }
+    }
+
+    liberarAdaptativo(a);
+    free(dados);
+    free(destino);
+}
+
+// ---------------------------------------------------------------------------
+// Entrada: arquivo mapeado ou entrada padrão
+// ---------------------------------------------------------------------------
+
+unsigned char *lerTudo(FILE *arquivo, const unsigned char *prefixo, size_t tamanhoPrefixo, size_t *n);
+
+// Função para obter a entrada inteira na memória
+// Arquivos são mapeados com mmap ('*mapeado' = 1); "-" lê a entrada padrão
+unsigned char *abrirEntrada(const char *caminho, size_t *n, int *mapeado)
+{
+    *mapeado = 0;
+    if (strcmp(caminho, "-") != 0)
+    {
+        int fd = open(caminho, O_RDONLY);
+        struct stat info;
+        if (fd < 0 || fstat(fd, &info) != 0)
+        {
+            fprintf(stderr, "Erro: Não foi possível abrir %s.\n", caminho);
+            exit(-1);
+        }
+        *n = (size_t)info.st_size;
+        if (*n > 0 && S_ISREG(info.st_mode))
+        {
+            void *mapa = mmap(NULL, *n, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (mapa == MAP_FAILED)
+            {
+                fprintf(stderr, "Erro: Falha no mmap de %s.\n", caminho);
+                exit(-1);
+            }
+            madvise(mapa, *n, MADV_SEQUENTIAL);
+            *mapeado = 1;
+            return (unsigned char *)mapa;
+        }
+        close(fd);
+        if (*n == 0 && S_ISREG(info.st_mode))
+            return NULL;
+        if (freopen(caminho, "rb", stdin) == NULL)
+        {
+            fprintf(stderr, "Erro: Não foi possível abrir %s.\n", caminho);
+            exit(-1);
+        }
+    }
+
+    return lerTudo(stdin, NULL, 0, n);
+}
+
+// Função para ler um arquivo até o fim, depois de 'prefixo' (bytes já lidos dele)
+// Lê em blocos dobrando o buffer
+unsigned char *lerTudo(FILE *arquivo, const unsigned char *prefixo, size_t tamanhoPrefixo, size_t *n)
+{
+    size_t capacidade = 1 << 20, tamanho = tamanhoPrefixo;
+    unsigned char *dados = (unsigned char *)malloc(capacidade);
+    size_t lidos;
+    if (dados != NULL && tamanhoPrefixo > 0)
+        memcpy(dados, prefixo, tamanhoPrefixo);
+    while (dados != NULL && (lidos = fread(dados + tamanho, 1, capacidade - tamanho, arquivo)) > 0)
+    {
+        tamanho += lidos;
+        if (tamanho == capacidade)
+        {
+            capacidade *= 2;
+            dados = (unsigned char *)realloc(dados, capacidade);
+        }
+    }
+    if (dados == NULL)
+    {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    *n = tamanho;
+    return dados;
+}
+
+void fecharEntrada(unsigned char *dados, size_t n, int mapeado)
+{
+    if (mapeado)
+        munmap(dados, n);
+    else
+        free(dados);
+}
+
+#ifdef BENCHMARK
+// Benchmark de vazão (gcc -O2 -DBENCHMARK Huffman.c -lm)
+// Uso: ./bench [arquivo ...]
+// Sem arquivos, usa três entradas sintéticas de 64 MB: um log de servidor,
+// texto com distribuição de Zipf sobre 40 símbolos e bytes aleatórios.
+// Mede compressão e descompressão em memória e confere o resultado, com blocos
+// de 128 KB e 1 MB, numa thread e com uma thread por processador.
+// ./bench --histograma [arquivo ...] compara só a contagem de frequências:
+// contador único, tabelas intercaladas e tabelas intercaladas em paralelo
+// (sem arquivos: 256 MB de bytes aleatórios, de um byte repetido e de log).
+// ./bench --comprimentos compara a construção dos comprimentos pela árvore com
+// heap e pelas duas filas com vários limites, no histograma do primeiro bloco
+// de cada entrada sintética: tempo por construção e bits por byte resultantes.
+// ./bench --adaptativo compara, em 16 MB de cada entrada sintética, as duas
+// passadas (blocos de 1 MB, uma thread) com o FGK e com o modo periódico de
+// 4, 16 e 64 KB, em quadros de QUADRO_MAXIMO bytes na memória.
+
+#define TAMANHO_SINTETICO (64 << 20)
+
+// Função para gerar um log com linhas parecidas com as de um servidor
+unsigned char *gerarLog(size_t n)
+{
+    static const char *niveis[] = {"INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR"};
+    static const char *rotas[] = {"/api/v1/users", "/api/v1/orders", "/healthz", "/static/app.js", "/login"};
+    unsigned char *dados = (unsigned char *)malloc(n + 256);
+    size_t pos = 0;
+    long segundo = 1700000000;
+    while (pos < n)
+    {
+        uint64_t r = benchAleatorio();
+        segundo += r % 3;
+        pos += (size_t)sprintf((char *)dados + pos, "%ld.%03d %s req=%08x GET %s status=%d ms=%d\n", segundo,
+                               (int)(r >> 8) % 1000, niveis[(r >> 20) % 6], (unsigned)(r >> 32),
+                               rotas[(r >> 24) % 5], (r >> 28) % 10 ? 200 : 404, (int)((r >> 40) % 500));
+    }
+    return dados;
+}
+
+// Função para gerar texto com símbolos em distribuição de Zipf
+unsigned char *gerarZipf(size_t n)
+{
+    static const char alfabeto[] = " etaoinshrdlcumwfgypbvkjxqz.,\n0123456789";
+    double acumulada[40], soma = 0;
+    for (int i = 0; i < 40; i++)
+        acumulada[i] = (soma += 1.0 / (i + 1));
+    unsigned char *dados = (unsigned char *)malloc(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        double u = (benchAleatorio() >> 11) * (1.0 / 9007199254740992.0) * soma;
+        int s = 0;
+        while (acumulada[s] < u)
+            s++;
+        dados[i] = (unsigned char)alfabeto[s];
+    }
+    return dados;
+}
+
+unsigned char *gerarAleatorio(size_t n)
+{
+    unsigned char *dados = (unsigned char *)malloc(n);
+    for (size_t i = 0; i < n; i++)
+        dados[i] = (unsigned char)benchAleatorio();
+    return dados;
+}
+
+unsigned char *gerarRepetido(size_t n)
+{
+    unsigned char *dados = (unsigned char *)malloc(n);
+    memset(dados, 'a', n);
+    return dados;
+}
+
+// Função para medir uma entrada e imprimir uma linha do CSV
+// Cada fase roda REPETICOES vezes reaproveitando as saídas (a primeira paga as
+// faltas de página da memória nova); vale o melhor tempo
+#define REPETICOES 3
+
+void medirEntrada(const char *nome, const unsigned char *dados, size_t n, int numThreads, size_t tamanhoBloco)
+{
+    Saida *comprimido = (Saida *)calloc(1, sizeof(Saida));
+    Saida *restaurado = (Saida *)calloc(1, sizeof(Saida));
+    uint64_t melhorCompressao = UINT64_MAX, melhorDescompressao = UINT64_MAX;
+
+    for (int r = 0; r < REPETICOES; r++)
+    {
+        comprimido->tamanho = 0;
+        uint64_t inicio = benchAgoraNs();
+        comprimir(dados, n, comprimido, numThreads, tamanhoBloco, LIMITE_PADRAO);
+        uint64_t tempo = benchAgoraNs() - inicio;
+        if (tempo < melhorCompressao)
+            melhorCompressao = tempo;
+    }
+    for (int r = 0; r < REPETICOES; r++)
+    {
+        restaurado->tamanho = 0;
+        uint64_t inicio = benchAgoraNs();
+        descomprimir(comprimido->memoria, comprimido->tamanho, restaurado, numThreads);
+        uint64_t tempo = benchAgoraNs() - inicio;
+        if (tempo < melhorDescompressao)
+            melhorDescompressao = tempo;
+    }
+
+    int ok = restaurado->tamanho == n && (n == 0 || memcmp(restaurado->memoria, dados, n) == 0);
+    double megabytes = n / 1e6;
+    printf("%s,%d,%zu,%zu,%zu,%.3f,%.1f,%.1f,%d\n", nome, numThreads, tamanhoBloco >> 10, n, comprimido->tamanho,
+           n ? 8.0 * comprimido->tamanho / n : 0, megabytes / (melhorCompressao / 1e9), megabytes / (melhorDescompressao / 1e9), ok);
+
+    free(comprimido->memoria);
+    free(restaurado->memoria);
+    free(comprimido);
+    free(restaurado);
+}
+
+// Função para medir uma entrada em todas as combinações de threads e blocos
+void medirCombinacoes(const char *nome, const unsigned char *dados, size_t n)
+{
+    int processadores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    size_t blocos[] = {128 << 10, BLOCO_PADRAO};
+    for (int b = 0; b < 2; b++)
+    {
+        medirEntrada(nome, dados, n, 1, blocos[b]);
+        if (processadores > 1)
+            medirEntrada(nome, dados, n, processadores, blocos[b]);
+    }
+}
+
+// Construção pela árvore com heap (um nó alocado por símbolo e por junção),
+// para comparação; com códigos acima de MAX_COMPRIMENTO, reduz as frequências
+// à metade e refaz a árvore
+int calcularComprimentos(No *raiz, int profundidade, unsigned char comprimentos[MAX_SIZE])
+{
+    if (!raiz->esquerda && !raiz->direita)
+    {
+        int comprimento = profundidade > 0 ? profundidade : 1;
+        comprimentos[raiz->caractere] = comprimento > 255 ? 255 : comprimento;
+        return comprimento;
+    }
+    int esquerda = calcularComprimentos(raiz->esquerda, profundidade + 1, comprimentos);
+    int direita = calcularComprimentos(raiz->direita, profundidade + 1, comprimentos);
+    return esquerda > direita ? esquerda : direita;
+}
+
+int comprimentosArvore(const uint64_t frequencias[MAX_SIZE], unsigned char comprimentos[MAX_SIZE])
+{
+    unsigned char caracteres[MAX_SIZE];
+    uint64_t contagens[MAX_SIZE];
+    int tamanho = 0;
+
+    memset(comprimentos, 0, MAX_SIZE);
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (frequencias[c] > 0)
+        {
+            caracteres[tamanho] = (unsigned char)c;
+            contagens[tamanho++] = frequencias[c];
+        }
+    }
+    if (tamanho == 0)
+        return 0;
+
+    for (;;)
+    {
+        No *raiz = construirArvoreHuffman(caracteres, contagens, tamanho);
+        int maior = calcularComprimentos(raiz, 0, comprimentos);
+        liberarArvoreHuffman(raiz);
+        if (maior <= MAX_COMPRIMENTO)
+            return maior;
+        for (int i = 0; i < tamanho; i++)
+            contagens[i] = (contagens[i] >> 1) | 1;
+    }
+}
+
+#define CONSTRUCOES 20000
+
+// Função para medir as construções num histograma
+void medirComprimentos(const char *nome, const uint64_t frequencias[MAX_SIZE])
+{
+    int limites[] = {MAX_COMPRIMENTO, 15, 12, LIMITE_PADRAO, 9};
+    uint64_t total = 0;
+    for (int c = 0; c < MAX_SIZE; c++)
+        total += frequencias[c];
+
+    for (int v = 0; v < 6; v++)
+    {
+        unsigned char comprimentos[MAX_SIZE];
+        int maior = 0;
+        uint64_t inicio = benchAgoraNs();
+        for (int r = 0; r < CONSTRUCOES; r++)
+            maior = v == 0 ? comprimentosArvore(frequencias, comprimentos)
+                           : comprimentosHuffman(frequencias, comprimentos, limites[v - 1]);
+        double ns = (double)(benchAgoraNs() - inicio) / CONSTRUCOES;
+
+        uint64_t bits = 0;
+        for (int c = 0; c < MAX_SIZE; c++)
+            bits += frequencias[c] * comprimentos[c];
+        printf("%s,%s,%d,%d,%.0f,%.4f\n", nome, v == 0 ? "arvore" : "duas_filas", v == 0 ? MAX_COMPRIMENTO : limites[v - 1],
+               maior, ns, (double)bits / total);
+    }
+}
+
+// Função para medir o modo adaptativo ('periodo' 0: FGK) numa entrada
+// O tamanho comprimido inclui os cabeçalhos dos quadros
+void medirAdaptativo(const char *nome, const unsigned char *dados, size_t n, size_t periodo)
+{
+    Adaptativo *codificador = criarAdaptativo(periodo, 0), *decodificador = criarAdaptativo(periodo, 1);
+    Saida *comprimido = (Saida *)calloc(1, sizeof(Saida));
+    size_t quadros = (n + QUADRO_MAXIMO - 1) / QUADRO_MAXIMO;
+    size_t *bytesQuadro = (size_t *)malloc((quadros + 1) * sizeof(size_t));
+    unsigned char *restaurado = (unsigned char *)malloc(n + 1);
+
+    uint64_t inicio = benchAgoraNs();
+    for (size_t q = 0; q < quadros; q++)
+    {
+        size_t antes = comprimido->tamanho, tamanho = q + 1 < quadros ? QUADRO_MAXIMO : n - q * QUADRO_MAXIMO;
+        codificarQuadro(codificador, dados + q * QUADRO_MAXIMO, tamanho, comprimido);
+        esvaziarSaida(comprimido);
+        bytesQuadro[q] = comprimido->tamanho - antes;
+    }
+    uint64_t tempoCompressao = benchAgoraNs() - inicio;
+
+    // O último quadro precisa de PREENCHIMENTO bytes legíveis depois do fim
+    for (int i = 0; i < PREENCHIMENTO; i++)
+        escreverByte(comprimido, 0);
+    esvaziarSaida(comprimido);
+
+    inicio = benchAgoraNs();
+    size_t pos = 0;
+    for (size_t q = 0; q < quadros; q++)
+    {
+        size_t tamanho = q + 1 < quadros ? QUADRO_MAXIMO : n - q * QUADRO_MAXIMO;
+        decodificarQuadro(decodificador, comprimido->memoria + pos, bytesQuadro[q], restaurado + q * QUADRO_MAXIMO,
+                          tamanho);
+        pos += bytesQuadro[q];
+    }
+    uint64_t tempoDescompressao = benchAgoraNs() - inicio;
+
+    size_t total = pos + 8 * (quadros + 1) + (periodo > 0 ? 8 : 4);
+    int ok = n == 0 || memcmp(restaurado, dados, n) == 0;
+    printf("%s,%s,%zu,%zu,%zu,%.3f,%.1f,%.1f,%d\n", nome, periodo > 0 ? "periodico" : "fgk", periodo >> 10, n, total,
+           8.0 * total / n, n / 1e6 / (tempoCompressao / 1e9), n / 1e6 / (tempoDescompressao / 1e9), ok);
+
+    liberarAdaptativo(codificador);
+    liberarAdaptativo(decodificador);
+    free(comprimido->memoria);
+    free(comprimido);
+    free(bytesQuadro);
+    free(restaurado);
+}
+
+// Contagem ingênua, para comparação
+void contarFrequenciasSimples(const unsigned char *dados, size_t n, uint64_t frequencias[MAX_SIZE])
+{
+    memset(frequencias, 0, MAX_SIZE * sizeof(uint64_t));
+    for (size_t i = 0; i < n; i++)
+        frequencias[dados[i]]++;
+}
+
+// Função para medir as três contagens numa entrada e conferir que concordam
+void medirHistograma(const char *nome, const unsigned char *dados, size_t n)
+{
+    int processadores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t referencia[MAX_SIZE], frequencias[MAX_SIZE];
+    contarFrequenciasSimples(dados, n, referencia);  // Também traz a entrada para a memória
+
+    const char *variantes[] = {"simples", "intercalado", "paralelo"};
+    for (int v = 0; v < 3; v++)
+    {
+        uint64_t melhor = UINT64_MAX;
+        for (int r = 0; r < REPETICOES; r++)
+        {
+            uint64_t inicio = benchAgoraNs();
+            if (v == 0)
+                contarFrequenciasSimples(dados, n, frequencias);
+            else if (v == 1)
+                contarFrequencias(dados, n, frequencias);
+            else
+                contarFrequenciasParalelo(dados, n, processadores, frequencias);
+            uint64_t tempo = benchAgoraNs() - inicio;
+            if (tempo < melhor)
+                melhor = tempo;
+        }
+        int ok = memcmp(frequencias, referencia, sizeof(referencia)) == 0;
+        printf("%s,%s,%d,%zu,%.1f,%d\n", nome, variantes[v], v == 2 ? processadores : 1, n,
+               n / 1e6 / (melhor / 1e9), ok);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "--histograma") == 0)
+    {
+        printf("entrada,variante,threads,bytes,mb_s,ok\n");
+        for (int i = 2; i < argc; i++)
+        {
+            size_t n;
+            int mapeado;
+            unsigned char *dados = abrirEntrada(argv[i], &n, &mapeado);
+            medirHistograma(argv[i], dados, n);
+            fecharEntrada(dados, n, mapeado);
+        }
+        if (argc > 2)
+            return 0;
+        unsigned char *(*geradores[])(size_t) = {gerarAleatorio, gerarRepetido, gerarLog};
+        const char *nomes[] = {"aleatorio", "repetido", "log"};
+        for (int i = 0; i < 3; i++)
+        {
+            unsigned char *dados = geradores[i](4 * TAMANHO_SINTETICO);
+            medirHistograma(nomes[i], dados, 4 * TAMANHO_SINTETICO);
+            free(dados);
+        }
+        return 0;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--comprimentos") == 0)
+    {
+        printf("entrada,metodo,limite,maior,ns_por_construcao,bits_por_byte\n");
+        unsigned char *(*geradores[])(size_t) = {gerarLog, gerarZipf, gerarAleatorio};
+        const char *nomes[] = {"log", "zipf", "aleatorio"};
+        for (int i = 0; i < 3; i++)
+        {
+            unsigned char *dados = geradores[i](BLOCO_PADRAO);
+            uint64_t frequencias[MAX_SIZE];
+            contarFrequencias(dados, BLOCO_PADRAO, frequencias);
+            medirComprimentos(nomes[i], frequencias);
+            free(dados);
+        }
+        // Frequências de Fibonacci: o pior caso, com a árvore mais funda possível
+        uint64_t fibonacci[MAX_SIZE] = {0};
+        fibonacci[0] = fibonacci[1] = 1;
+        for (int c = 2; c < 40; c++)
+            fibonacci[c] = fibonacci[c - 1] + fibonacci[c - 2];
+        medirComprimentos("fibonacci", fibonacci);
+        return 0;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--adaptativo") == 0)
+    {
+        printf("entrada,modo,periodo_kb,bytes,comprimido,bits_por_byte,comprimir_mb_s,descomprimir_mb_s,ok\n");
+        unsigned char *(*geradores[])(size_t) = {gerarLog, gerarZipf, gerarAleatorio};
+        const char *nomes[] = {"log", "zipf", "aleatorio"};
+        size_t n = TAMANHO_SINTETICO / 4;
+        for (int i = 0; i < 3; i++)
+        {
+            unsigned char *dados = geradores[i](n);
+            Saida *comprimido = (Saida *)calloc(1, sizeof(Saida));
+            Saida *restaurado = (Saida *)calloc(1, sizeof(Saida));
+            uint64_t inicio = benchAgoraNs();
+            comprimir(dados, n, comprimido, 1, BLOCO_PADRAO, LIMITE_PADRAO);
+            uint64_t meio = benchAgoraNs();
+            descomprimir(comprimido->memoria, comprimido->tamanho, restaurado, 1);
+            uint64_t fim = benchAgoraNs();
+            printf("%s,dois_passos,0,%zu,%zu,%.3f,%.1f,%.1f,%d\n", nomes[i], n, comprimido->tamanho,
+                   8.0 * comprimido->tamanho / n, n / 1e6 / ((meio - inicio) / 1e9), n / 1e6 / ((fim - meio) / 1e9),
+                   restaurado->tamanho == n && memcmp(restaurado->memoria, dados, n) == 0);
+            free(comprimido->memoria);
+            free(restaurado->memoria);
+            free(comprimido);
+            free(restaurado);
+
+            size_t periodos[] = {0, 4 << 10, PERIODO_PADRAO, 64 << 10};
+            for (int p = 0; p < 4; p++)
+                medirAdaptativo(nomes[i], dados, n, periodos[p]);
+            free(dados);
+        }
+        return 0;
+    }
+
+    printf("entrada,threads,bloco_kb,bytes,comprimido,bits_por_byte,comprimir_mb_s,descomprimir_mb_s,ok\n");
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            size_t n;
+            int mapeado;
+            unsigned char *dados = abrirEntrada(argv[i], &n, &mapeado);
+            medirCombinacoes(argv[i], dados, n);
+            fecharEntrada(dados, n, mapeado);
+        }
+        return 0;
+    }
+
+    unsigned char *(*geradores[])(size_t) = {gerarLog, gerarZipf, gerarAleatorio};
+    const char *nomes[] = {"log", "zipf", "aleatorio"};
+    for (int i = 0; i < 3; i++)
+    {
+        unsigned char *dados = geradores[i](TAMANHO_SINTETICO);
+        medirCombinacoes(nomes[i], dados, TAMANHO_SINTETICO);
+        free(dados);
+    }
+    return 0;
+}
+#else
 // Função principal
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1)
+    {
+        int comprimirModo = strcmp(argv[1], "-c") == 0, frequenciasModo = strcmp(argv[1], "-f") == 0;
+        int adaptativoModo = strcmp(argv[1], "-a") == 0;
+        int numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        long blocoKb = BLOCO_PADRAO >> 10;
+        int limite = LIMITE_PADRAO, a = 2;
+        long periodoKb = 0;
+        for (; a + 1 < argc && argv[a][0] == '-' && argv[a][1] != '\0' && strchr("tblr", argv[a][1]) && argv[a][2] == '\0';
+             a += 2)
+        {
+            if (argv[a][1] == 't')
+                numThreads = atoi(argv[a + 1]);
+            else if (argv[a][1] == 'b')
+                blocoKb = atol(argv[a + 1]);
+            else if (argv[a][1] == 'l')
+                limite = atoi(argv[a + 1]);
+            else
+                periodoKb = atol(argv[a + 1]);
+        }
+        if ((!comprimirModo && !frequenciasModo && !adaptativoModo && strcmp(argv[1], "-d") != 0) || numThreads < 1 ||
+            blocoKb < 1 || blocoKb > (BLOCO_MAXIMO >> 10) || limite < 8 || limite > MAX_COMPRIMENTO || periodoKb < 0 ||
+            periodoKb > (1L << 21))
+        {
+            fprintf(stderr, "Uso: %s -c|-d|-f [-t threads] [-b KB] [-l bits] [entrada|-] [saida|-]\n", argv[0]);
+            fprintf(stderr, "     %s -a [-r KB] [entrada|-] [saida|-]\n", argv[0]);
+            return 1;
+        }
+        const char *caminho = argc > a ? argv[a] : "-";
+
+        Saida *saida = (Saida *)calloc(1, sizeof(Saida));
+        saida->arquivo = argc > a + 1 && strcmp(argv[a + 1], "-") != 0 ? fopen(argv[a + 1], "wb") : stdout;
+        if (saida->arquivo == NULL)
+        {
+            fprintf(stderr, "Erro: Não foi possível criar %s.\n", argv[a + 1]);
+            return 1;
+        }
+
+        // O modo adaptativo lê aos poucos: nada de mapear ou carregar a entrada
+        FILE *entrada = strcmp(caminho, "-") != 0 ? fopen(caminho, "rb") : stdin;
+        if (entrada == NULL)
+        {
+            fprintf(stderr, "Erro: Não foi possível abrir %s.\n", caminho);
+            return 1;
+        }
+        unsigned char assinatura[4];
+        size_t lidos = 0;
+        int adaptativo = adaptativoModo;
+        if (adaptativoModo)
+            comprimirAdaptativo(fileno(entrada), saida->arquivo, (size_t)periodoKb << 10);
+        else if (!comprimirModo && !frequenciasModo)
+        {
+            lidos = fread(assinatura, 1, 4, entrada);
+            adaptativo = lidos == 4 && ehAdaptativo(assinatura);
+            if (adaptativo)
+                descomprimirAdaptativo(entrada, assinatura, saida->arquivo);
+        }
+        if (adaptativo)
+        {
+            int falhou = fclose(saida->arquivo) != 0;
+            free(saida);
+            if (entrada != stdin)
+                fclose(entrada);
+            if (falhou)
+            {
+                fprintf(stderr, "Erro: Falha na gravação.\n");
+                return 1;
+            }
+            return 0;
+        }
+
+        size_t n;
+        int mapeado = 0;
+        unsigned char *dados;
+        struct stat info;
+        if (lidos > 0 && (entrada == stdin || fstat(fileno(entrada), &info) != 0 || !S_ISREG(info.st_mode)))
+        {
+            // Pipes não voltam atrás: o resto é lido depois da assinatura
+            dados = lerTudo(entrada, assinatura, lidos, &n);
+            if (entrada != stdin)
+                fclose(entrada);
+        }
+        else
+        {
+            if (entrada != stdin)
+                fclose(entrada);
+            dados = abrirEntrada(caminho, &n, &mapeado);
+        }
+
+        if (frequenciasModo)
+        {
+            uint64_t frequencias[MAX_SIZE];
+            contarFrequenciasParalelo(dados, n, numThreads, frequencias);
+            for (int c = 0; c < MAX_SIZE; c++)
+            {
+                if (frequencias[c] > 0)
+                    fprintf(saida->arquivo, "%d,%llu\n", c, (unsigned long long)frequencias[c]);
+            }
+        }
+        else if (comprimirModo)
+            comprimir(dados, n, saida, numThreads, (size_t)blocoKb << 10, limite);
+        else
+            descomprimir(dados, n, saida, numThreads);
+
+        if (fclose(saida->arquivo) != 0)
+        {
+            fprintf(stderr, "Erro: Falha na gravação.\n");
+            return 1;
+        }
+        free(saida);
+        fecharEntrada(dados, n, mapeado);
+        return 0;
+    }
+
     char caracteres[MAX_SIZE];
-    int frequencias[MAX_SIZE] = {0};
+    uint64_t frequencias[MAX_SIZE];
 
     printf("Digite uma string: ");
-    gets(caracteres);
+    if (fgets(caracteres, sizeof(caracteres), stdin) == NULL)
+        return 0;
+    caracteres[strcspn(caracteres, "\n")] = '\0';
 
     int tamanho = strlen(caracteres);
+    if (tamanho == 0)
+        return 0;
 
-    for (int i = 0; i < tamanho; ++i)
-        frequencias[caracteres[i]]++;
+    // Cada símbolo entra uma vez na árvore, com a sua contagem
+    contarFrequencias((unsigned char *)caracteres, tamanho, frequencias);
+    unsigned char simbolos[MAX_SIZE];
+    uint64_t contagens[MAX_SIZE];
+    int distintos = 0;
+    for (int c = 0; c < MAX_SIZE; c++)
+    {
+        if (frequencias[c] > 0)
+        {
+            simbolos[distintos] = (unsigned char)c;
+            contagens[distintos++] = frequencias[c];
+        }
+    }
 
-    No *raiz = construirArvoreHuffman(caracteres, frequencias, tamanho);
+    No *raiz = construirArvoreHuffman(simbolos, contagens, distintos);
 
     int codigo[MAX_SIZE], indice = 0;
     printf("Codigos Huffman:\n");
     imprimirCodigosHuffman(raiz, codigo, indice);
+    liberarArvoreHuffman(raiz);
+
+    // Comprime e descomprime a string em memória
+    Saida *comprimido = (Saida *)calloc(1, sizeof(Saida));
+    Saida *restaurado = (Saida *)calloc(1, sizeof(Saida));
+    comprimir((unsigned char *)caracteres, tamanho, comprimido, 1, BLOCO_PADRAO, LIMITE_PADRAO);
+    descomprimir(comprimido->memoria, comprimido->tamanho, restaurado, 1);
+    printf("Comprimido: %zu bytes (%d de entrada, cabeçalhos, índice e preenchimento de %d)\n", comprimido->tamanho,
+           tamanho, TAMANHO_CABECALHO + TAMANHO_MAPA + distintos + 4 * NUM_FLUXOS + PREENCHIMENTO + 4);
+    printf("Restaurado: %.*s\n", (int)restaurado->tamanho, (char *)restaurado->memoria);
+    free(comprimido->memoria);
+    free(restaurado->memoria);
+    free(comprimido);
+    free(restaurado);
 
     return 0;
 }
+#endif
@@ -0,0 +1,288 @@
+#include <stdio.h>   // Inclui a biblioteca padrão de entrada e saída
+#include <stdlib.h>  // Inclui a biblioteca padrão de alocação de memória
+#include <stdint.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece os temporizadores
+#endif
+
+// Índice estático de busca no layout de Eytzinger (ordem de largura).
+//
+// É uma árvore binária de busca completa (só o último nível pode ficar
+// incompleto, preenchido da esquerda para a direita) com as mesmas chaves, na
+// mesma ordem simétrica, de um vetor ordenado. A forma não é a que
+// inserirElementos monta pelo meio do vetor; só a sequência em ordem coincide.
+// Fica guardada num único vetor: a raiz fica em chaves[1] e os filhos de k
+// ficam em 2k e 2k+1. Não há ponteiros. Os primeiros níveis
+// ficam juntos nas mesmas linhas de cache e, como os 16 descendentes de k
+// quatro níveis abaixo (16k..16k+15) são contíguos, a busca pode pedir essa
+// linha com antecedência.
+
+#define EYTZINGER_LINHA 64                                  // Bytes por linha de cache
+#define EYTZINGER_POR_LINHA (EYTZINGER_LINHA / sizeof(int))  // 16 chaves: 4 níveis à frente
+
+// Estrutura do índice
+typedef struct IndiceEytzinger {
+    int* chaves;   // chaves[1..n] em ordem de largura; chaves[0] não é usada
+    void* bloco;   // Memória alocada (chaves é alinhado a uma linha de cache dentro dele)
+    long n;        // Número de chaves
+} IndiceEytzinger;
+
+// Estrutura de um nó da árvore binária (para comparar com o índice)
+typedef struct NoArvore {
+    int dado;
+    struct NoArvore* esquerda;
+    struct NoArvore* direita;
+} NoArvore;
+
+// Função para preencher o vetor de Eytzinger com um percurso em ordem da árvore implícita
+// 'i' é a próxima chave do vetor ordenado; retorna o índice seguinte
+long preencherEytzinger(const int vetor[], int chaves[], long n, long i, long k) {
+    if (k <= n) {
+        i = preencherEytzinger(vetor, chaves, n, i, 2 * k);
+        chaves[k] = vetor[i++];
+        i = preencherEytzinger(vetor, chaves, n, i, 2 * k + 1);
+    }
+    return i;
+}
+
+// Função para criar o índice a partir de um vetor ordenado
+IndiceEytzinger* criarIndiceEytzinger(const int vetor[], long n) {
+    IndiceEytzinger* indice = (IndiceEytzinger*)malloc(sizeof(IndiceEytzinger));
+    if (indice == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    // Uma linha a mais para alinhar o início (a pré-busca além do fim não falha)
+    indice->bloco = malloc((n + 1) * sizeof(int) + EYTZINGER_LINHA);
+    if (indice->bloco == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    uintptr_t endereco = ((uintptr_t)indice->bloco + EYTZINGER_LINHA - 1) & ~(uintptr_t)(EYTZINGER_LINHA - 1);
+    indice->chaves = (int*)endereco;
+    indice->n = n;
+    preencherEytzinger(vetor, indice->chaves, n, 0, 1);
+    return indice;
+}
+
+void liberarIndiceEytzinger(IndiceEytzinger* indice) {
+    free(indice->bloco);
+    free(indice);
+}
+
+// Função para descer a árvore implícita sem desvios
+// A cada nível k vira 2k (vai para a esquerda) ou 2k+1 (direita) pela comparação;
+// no fim, os bits de k registram o caminho. A última descida à esquerda é o
+// resultado: removendo os 1s finais e mais um bit chega-se a ela (0 = nenhum).
+static inline long descerEytzinger(const IndiceEytzinger* indice, int chave, int inclusivo) {
+    const int* chaves = indice->chaves;
+    long n = indice->n;
+    long k = 1;
+
+    while (k <= n) {
+        // Pede a linha com os descendentes 4 níveis abaixo enquanto compara este nível
+        __builtin_prefetch(chaves + EYTZINGER_POR_LINHA * k);
+        k = 2 * k + (inclusivo ? chaves[k] <= chave : chaves[k] < chave);
+    }
+    return k >> __builtin_ffsl(~k);
+}
+
+// Posição (no vetor do índice) da primeira chave >= chave, ou 0 se não houver
+long limiteInferiorEytzinger(const IndiceEytzinger* indice, int chave) {
+    return descerEytzinger(indice, chave, 0);
+}
+
+// Posição (no vetor do índice) da primeira chave > chave, ou 0 se não houver
+long limiteSuperiorEytzinger(const IndiceEytzinger* indice, int chave) {
+    return descerEytzinger(indice, chave, 1);
+}
+
+// Função para verificar se a chave está no índice
+int buscarEytzinger(const IndiceEytzinger* indice, int chave) {
+    long k = limiteInferiorEytzinger(indice, chave);
+    return k != 0 && indice->chaves[k] == chave;
+}
+
+// Função para avançar à próxima posição em ordem (para percorrer um intervalo)
+long sucessorEytzinger(const IndiceEytzinger* indice, long k) {
+    if (2 * k + 1 <= indice->n) {
+        // Menor chave da subárvore direita
+        k = 2 * k + 1;
+        while (2 * k <= indice->n)
+            k = 2 * k;
+        return k;
+    }
+    // Sobe enquanto for filho direito; o pai do primeiro filho esquerdo é o sucessor
+    while (k & 1)
+        k >>= 1;
+    return k >> 1;
+}
+
+// Função para criar um novo nó
+NoArvore* criarNo(int dado) {
+    NoArvore* novoNo = (NoArvore*)malloc(sizeof(NoArvore));
+    if (novoNo == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    novoNo->dado = dado;
+    novoNo->esquerda = NULL;
+    novoNo->direita = NULL;
+    return novoNo;
+}
+
+// Função para inserir elementos na árvore balanceada a partir de um vetor ordenado
+NoArvore* inserirElementos(const int vetor[], long inicio, long fim) {
+    if (inicio > fim)
+        return NULL;
+
+    long meio = (inicio + fim) / 2;
+    NoArvore* novoNo = criarNo(vetor[meio]);
+    novoNo->esquerda = inserirElementos(vetor, inicio, meio - 1);
+    novoNo->direita = inserirElementos(vetor, meio + 1, fim);
+    return novoNo;
+}
+
+// Função para buscar um elemento na árvore de ponteiros
+NoArvore* buscarElemento(NoArvore* raiz, int dado) {
+    while (raiz != NULL && raiz->dado != dado)
+        raiz = dado < raiz->dado ? raiz->esquerda : raiz->direita;
+    return raiz;
+}
+
+void liberarArvore(NoArvore* raiz) {
+    if (raiz != NULL) {
+        liberarArvore(raiz->esquerda);
+        liberarArvore(raiz->direita);
+        free(raiz);
+    }
+}
+
+// Busca binária clássica no vetor ordenado (primeira posição com vetor[i] >= chave)
+long limiteInferiorBinario(const int vetor[], long n, int chave) {
+    long inicio = 0, fim = n;
+    while (inicio < fim) {
+        long meio = inicio + (fim - inicio) / 2;
+        if (vetor[meio] < chave)
+            inicio = meio + 1;
+        else
+            fim = meio;
+    }
+    return inicio;
+}
+
+// Busca binária sem desvios: o intervalo cai pela metade com um movimento condicional
+long limiteInferiorBinarioSemDesvio(const int vetor[], long n, int chave) {
+    const int* base = vetor;
+    if (n == 0)
+        return 0;
+    while (n > 1) {
+        long metade = n / 2;
+        base = base[metade - 1] < chave ? base + metade : base;
+        n -= metade;
+    }
+    return (base - vetor) + (*base < chave);
+}
+
+#ifdef BENCHMARK
+// Benchmark de busca (gcc -O2 -DBENCHMARK IndiceEytzinger.c -lm)
+// Uso: ./bench [n ...]  (padrão 10^3 a 10^8; 10^9 precisa de ~8 GB)
+// As chaves são os pares 0, 2, 4, ...; metade das consultas cai entre duas chaves.
+// A árvore de ponteiros só é montada até LIMITE_PONTEIROS chaves (24+ bytes por nó).
+
+#define CONSULTAS 2000000
+#define LIMITE_PONTEIROS 100000000L
+
+int main(int argc, char* argv[]) {
+    long padrao[] = {1000, 10000, 100000, 1000000, 10000000, 100000000};
+    int quantos = argc > 1 ? argc - 1 : (int)(sizeof(padrao) / sizeof(padrao[0]));
+    int* consultas = (int*)malloc(sizeof(int) * CONSULTAS);
+
+    printf("variante,n,ns_por_consulta,encontradas\n");
+    for (int t = 0; t < quantos; t++) {
+        long n = argc > 1 ? atol(argv[t + 1]) : padrao[t];
+        if (n <= 0 || n > 1000000000L) {
+            printf("Erro: n deve estar entre 1 e 10^9.\n");
+            exit(-1);
+        }
+
+        int* vetor = (int*)malloc(sizeof(int) * n);
+        for (long i = 0; i < n; i++)
+            vetor[i] = (int)(2 * i);
+        for (int i = 0; i < CONSULTAS; i++)
+            consultas[i] = (int)(benchAleatorio() % (uint64_t)(2 * n));
+
+        IndiceEytzinger* indice = criarIndiceEytzinger(vetor, n);
+        NoArvore* raiz = n <= LIMITE_PONTEIROS ? inserirElementos(vetor, 0, n - 1) : NULL;
+
+        long encontradas;
+        uint64_t inicio;
+
+#define MEDIR(nome, teste)                                                                  \
+        encontradas = 0;                                                                    \
+        inicio = benchAgoraNs();                                                            \
+        for (int i = 0; i < CONSULTAS; i++) {                                               \
+            int chave = consultas[i];                                                       \
+            encontradas += (teste);                                                         \
+        }                                                                                   \
+        printf("%s,%ld,%.2f,%ld\n", nome, n, (double)(benchAgoraNs() - inicio) / CONSULTAS, \
+               encontradas);
+
+        if (raiz != NULL) {
+            MEDIR("ponteiros", buscarElemento(raiz, chave) != NULL);
+        }
+        MEDIR("binaria", ({ long p = limiteInferiorBinario(vetor, n, chave); p < n && vetor[p] == chave; }));
+        MEDIR("binaria_sem_desvio",
+              ({ long p = limiteInferiorBinarioSemDesvio(vetor, n, chave); p < n && vetor[p] == chave; }));
+        MEDIR("eytzinger", buscarEytzinger(indice, chave));
+#undef MEDIR
+
+        liberarArvore(raiz);
+        liberarIndiceEytzinger(indice);
+        free(vetor);
+    }
+    free(consultas);
+    return 0;
+}
+#else
+// Função principal para testar o índice
+int main() {
+    int vetor[] = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    long n = sizeof(vetor) / sizeof(vetor[0]);
+
+    IndiceEytzinger* indice = criarIndiceEytzinger(vetor, n);
+
+    printf("Layout de Eytzinger: ");
+    for (long k = 1; k <= n; k++)
+        printf("%d ", indice->chaves[k]);
+    printf("\n");
+
+    printf("Em ordem pelo índice: ");
+    for (long k = limiteInferiorEytzinger(indice, vetor[0]); k != 0; k = sucessorEytzinger(indice, k))
+        printf("%d ", indice->chaves[k]);
+    printf("\n");
+
+    int testes[] = {0, 7, 8, 19, 20};
+    for (int i = 0; i < 5; i++) {
+        long inferior = limiteInferiorEytzinger(indice, testes[i]);
+        long superior = limiteSuperiorEytzinger(indice, testes[i]);
+        printf("Chave %2d: %s, limite inferior = ", testes[i],
+               buscarEytzinger(indice, testes[i]) ? "encontrada" : "ausente");
+        if (inferior != 0) printf("%d", indice->chaves[inferior]); else printf("fim");
+        printf(", limite superior = ");
+        if (superior != 0) printf("%d", indice->chaves[superior]); else printf("fim");
+        printf("\n");
+    }
+
+    // Intervalo [6, 14): do limite inferior de 6 até o limite inferior de 14
+    printf("Intervalo [6, 14): ");
+    long fim = limiteInferiorEytzinger(indice, 14);
+    for (long k = limiteInferiorEytzinger(indice, 6); k != fim; k = sucessorEytzinger(indice, k))
+        printf("%d ", indice->chaves[k]);
+    printf("\n");
+
+    liberarIndiceEytzinger(indice);
+    return 0;
+}
+#endif
@@ -0,0 +1,635 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece os temporizadores
+#endif
+
+// Ordenação externa de arquivos binários de int32 maiores que a memória.
+//
+// 1. Geração de execuções por seleção por substituição: um heap de mínimo do
+//    tamanho do orçamento de memória emite o menor elemento e o substitui pelo
+//    próximo da entrada; se o novo for menor que o último emitido, ele fica
+//    marcado para a próxima execução. Em entrada aleatória as execuções saem
+//    com ~2x o orçamento (e uma só se a entrada já estiver quase ordenada).
+//    Com um heap bem maior que a cache, porém, cada elemento paga ~log n
+//    faltas de cache; a alternativa GERACAO_RADIX enche metade do orçamento,
+//    ordena com radix sort (4 passadas de 8 bits, sequenciais) e grava:
+//    execuções menores, mas geradas na velocidade do disco.
+// 2. Intercalação k-way com uma árvore de perdedores: cada nó interno guarda o
+//    perdedor da sua disputa, então trocar o vencedor custa log2(k) comparações
+//    subindo por um único caminho. Se houver mais execuções do que cabem no
+//    orçamento, intercala em várias passadas.
+// E/S: a escrita usa dois buffers grandes, e uma thread grava um enquanto o
+// outro é preenchido; a leitura usa blocos grandes e pede ao núcleo (fadvise
+// WILLNEED) o bloco seguinte enquanto o atual é consumido.
+//
+// Compilar com: gcc -O2 -pthread OrdenacaoExterna.c
+// Uso: ./ordenar entrada saida [memoria_MB] [radix]   (sem argumentos roda uma demonstração)
+
+#define BLOCO_MAXIMO (1 << 20)  // Bytes por bloco de E/S
+
+// ---------------------------------------------------------------------------
+// Escrita com buffer duplo
+// ---------------------------------------------------------------------------
+
+// Estrutura do escritor: o produtor enche 'buffers[atual]' enquanto a thread grava o outro
+typedef struct EscritorDuplo {
+    int fd;
+    int32_t* buffers[2];
+    size_t capacidade;      // Inteiros por buffer
+    size_t usados;          // Inteiros no buffer atual
+    int atual;
+    int pendente;           // Buffer entregue à thread (-1 se nenhum)
+    size_t tamanhoPendente; // Inteiros no buffer pendente
+    int encerrar;
+    int erro;
+    int semThread;  // 1 se a thread não subiu: os buffers são gravados na hora
+    pthread_t thread;
+    pthread_mutex_t trava;
+    pthread_cond_t sinal;
+} EscritorDuplo;
+
+// Função para gravar um bloco inteiro
+static int gravarTudo(int fd, const void* dados, size_t tamanho) {
+    const char* p = (const char*)dados;
+    while (tamanho > 0) {
+        ssize_t gravado = write(fd, p, tamanho);
+        if (gravado <= 0)
+            return -1;
+        p += gravado;
+        tamanho -= (size_t)gravado;
+    }
+    return 0;
+}
+
+// Thread de gravação: espera um buffer pendente, grava e avisa o produtor
+void* threadEscritora(void* arg) {
+    EscritorDuplo* e = (EscritorDuplo*)arg;
+    pthread_mutex_lock(&e->trava);
+    for (;;) {
+        while (e->pendente < 0 && !e->encerrar)
+            pthread_cond_wait(&e->sinal, &e->trava);
+        if (e->pendente < 0)
+            break;  // Encerrar e nada pendente
+        int buffer = e->pendente;
+        size_t tamanho = e->tamanhoPendente;
+        pthread_mutex_unlock(&e->trava);
+
+        int falhou = gravarTudo(e->fd, e->buffers[buffer], tamanho * sizeof(int32_t));
+
+        pthread_mutex_lock(&e->trava);
+        e->erro |= falhou;
+        e->pendente = -1;
+        pthread_cond_broadcast(&e->sinal);
+    }
+    pthread_mutex_unlock(&e->trava);
+    return NULL;
+}
+
+// Função para abrir o arquivo de saída e iniciar a thread de gravação
+EscritorDuplo* abrirEscritor(const char* caminho, size_t bytesBloco) {
+    EscritorDuplo* e = (EscritorDuplo*)calloc(1, sizeof(EscritorDuplo));
+    e->fd = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (e->fd < 0) {
+        printf("Erro: Não foi possível criar %s.\n", caminho);
+        exit(-1);
+    }
+    e->capacidade = bytesBloco / sizeof(int32_t);
+    e->buffers[0] = (int32_t*)malloc(bytesBloco);
+    e->buffers[1] = (int32_t*)malloc(bytesBloco);
+    if (e->buffers[0] == NULL || e->buffers[1] == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    e->pendente = -1;
+    pthread_mutex_init(&e->trava, NULL);
+    pthread_cond_init(&e->sinal, NULL);
+    e->semThread = pthread_create(&e->thread, NULL, threadEscritora, e) != 0;
+    return e;
+}
+
+// Função para entregar o buffer atual à thread e passar a encher o outro
+static void trocarBuffer(EscritorDuplo* e) {
+    if (e->semThread) {
+        // Ninguém consumiria o pendente: grava aqui mesmo e segue no mesmo buffer
+        e->erro |= gravarTudo(e->fd, e->buffers[e->atual], e->usados * sizeof(int32_t));
+        e->usados = 0;
+        return;
+    }
+    pthread_mutex_lock(&e->trava);
+    while (e->pendente >= 0)  // O outro buffer ainda está sendo gravado
+        pthread_cond_wait(&e->sinal, &e->trava);
+    e->pendente = e->atual;
+    e->tamanhoPendente = e->usados;
+    pthread_cond_broadcast(&e->sinal);
+    pthread_mutex_unlock(&e->trava);
+    e->atual ^= 1;
+    e->usados = 0;
+}
+
+static inline void escrever(EscritorDuplo* e, int32_t valor) {
+    e->buffers[e->atual][e->usados++] = valor;
+    if (e->usados == e->capacidade)
+        trocarBuffer(e);
+}
+
+// Função para gravar o que falta, encerrar a thread e fechar o arquivo
+void fecharEscritor(EscritorDuplo* e) {
+    if (e->usados > 0)
+        trocarBuffer(e);
+    if (!e->semThread) {
+        pthread_mutex_lock(&e->trava);
+        e->encerrar = 1;
+        pthread_cond_broadcast(&e->sinal);
+        pthread_mutex_unlock(&e->trava);
+        pthread_join(e->thread, NULL);
+    }
+
+    if (e->erro || close(e->fd) != 0) {
+        printf("Erro: Falha na gravação.\n");
+        exit(-1);
+    }
+    pthread_mutex_destroy(&e->trava);
+    pthread_cond_destroy(&e->sinal);
+    free(e->buffers[0]);
+    free(e->buffers[1]);
+    free(e);
+}
+
+// ---------------------------------------------------------------------------
+// Leitura em blocos com leitura antecipada
+// ---------------------------------------------------------------------------
+
+// Estrutura do leitor
+typedef struct LeitorBloco {
+    int fd;
+    int32_t* buffer;
+    size_t capacidade;  // Inteiros por bloco
+    size_t n, pos;      // Inteiros no bloco e próximo a entregar
+    off_t deslocamento; // Posição no arquivo do próximo bloco
+    int acabou;
+} LeitorBloco;
+
+// Função para ler o próximo bloco e pedir ao núcleo o seguinte
+static void carregarBloco(LeitorBloco* l) {
+    size_t bytes = l->capacidade * sizeof(int32_t);
+    ssize_t lido = 0, total = 0;
+    while ((size_t)total < bytes && (lido = read(l->fd, (char*)l->buffer + total, bytes - total)) > 0)
+        total += lido;
+    if (lido < 0) {
+        printf("Erro: Falha na leitura.\n");
+        exit(-1);
+    }
+    l->deslocamento += total;
+    l->n = (size_t)total / sizeof(int32_t);
+    l->pos = 0;
+    l->acabou = l->n == 0;
+    if (!l->acabou)
+        posix_fadvise(l->fd, l->deslocamento, bytes, POSIX_FADV_WILLNEED);
+}
+
+LeitorBloco* abrirLeitor(const char* caminho, size_t bytesBloco) {
+    LeitorBloco* l = (LeitorBloco*)calloc(1, sizeof(LeitorBloco));
+    l->fd = open(caminho, O_RDONLY);
+    if (l->fd < 0) {
+        printf("Erro: Não foi possível abrir %s.\n", caminho);
+        exit(-1);
+    }
+    posix_fadvise(l->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    l->capacidade = bytesBloco / sizeof(int32_t);
+    l->buffer = (int32_t*)malloc(bytesBloco);
+    if (l->buffer == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    carregarBloco(l);
+    return l;
+}
+
+// Função para ler o próximo inteiro; retorna 0 no fim do arquivo
+static inline int ler(LeitorBloco* l, int32_t* valor) {
+    if (l->pos == l->n) {
+        if (l->acabou)
+            return 0;
+        carregarBloco(l);
+        if (l->acabou)
+            return 0;
+    }
+    *valor = l->buffer[l->pos++];
+    return 1;
+}
+
+void fecharLeitor(LeitorBloco* l) {
+    close(l->fd);
+    free(l->buffer);
+    free(l);
+}
+
+// ---------------------------------------------------------------------------
+// Geração de execuções: seleção por substituição
+// ---------------------------------------------------------------------------
+
+// Chave do heap: número da execução nos 32 bits altos e o valor (com o bit de
+// sinal invertido, para a ordem sem sinal coincidir com a com sinal) nos baixos
+static inline uint64_t chaveExecucao(uint32_t execucao, int32_t valor) {
+    return ((uint64_t)execucao << 32) | ((uint32_t)valor ^ 0x80000000u);
+}
+
+static inline int32_t valorDaChave(uint64_t chave) {
+    return (int32_t)((uint32_t)chave ^ 0x80000000u);
+}
+
+// Função para descer a chave da posição i no heap de mínimo (buraco)
+static void descerMinimo(uint64_t heap[], size_t n, size_t i) {
+    uint64_t valor = heap[i];
+    while (2 * i + 1 < n) {
+        size_t menor = 2 * i + 1;
+        if (menor + 1 < n && heap[menor + 1] < heap[menor])
+            menor++;
+        if (heap[menor] >= valor)
+            break;
+        heap[i] = heap[menor];
+        i = menor;
+    }
+    heap[i] = valor;
+}
+
+// Função para montar o nome do arquivo de uma execução
+static void nomeExecucao(char* destino, size_t tamanho, const char* base, int passada, int indice) {
+    snprintf(destino, tamanho, "%s.exec%d_%d", base, passada, indice);
+}
+
+// Função para gerar as execuções ordenadas; retorna quantas foram criadas
+int gerarExecucoes(const char* entrada, const char* base, size_t memoria, size_t bytesBloco, long long* total) {
+    size_t capacidade = memoria / sizeof(uint64_t);
+    uint64_t* heap = (uint64_t*)malloc(capacidade * sizeof(uint64_t));
+    if (heap == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    LeitorBloco* leitor = abrirLeitor(entrada, bytesBloco);
+    size_t n = 0;
+    int32_t valor;
+    while (n < capacidade && ler(leitor, &valor))
+        heap[n++] = chaveExecucao(0, valor);
+    *total = n;
+    for (size_t i = n / 2; i-- > 0;)
+        descerMinimo(heap, n, i);
+
+    char nome[4096];
+    int execucoes = 0;
+    uint32_t atual = 0;
+    EscritorDuplo* escritor = NULL;
+    while (n > 0) {
+        uint32_t execucao = (uint32_t)(heap[0] >> 32);
+        if (escritor == NULL || execucao != atual) {
+            if (escritor != NULL)
+                fecharEscritor(escritor);
+            nomeExecucao(nome, sizeof(nome), base, 0, execucoes++);
+            escritor = abrirEscritor(nome, bytesBloco);
+            atual = execucao;
+        }
+        int32_t menor = valorDaChave(heap[0]);
+        escrever(escritor, menor);
+
+        if (ler(leitor, &valor)) {
+            // Menor que o que acabou de sair: não cabe mais nesta execução
+            heap[0] = chaveExecucao(valor >= menor ? execucao : execucao + 1, valor);
+            (*total)++;
+        } else {
+            heap[0] = heap[--n];
+        }
+        if (n > 0)
+            descerMinimo(heap, n, 0);
+    }
+    if (escritor != NULL)
+        fecharEscritor(escritor);
+
+    fecharLeitor(leitor);
+    free(heap);
+    return execucoes;
+}
+
+// Função para ordenar n inteiros com radix sort LSD de 8 bits ('temp' tem n posições)
+static void radixSort(int32_t vetor[], int32_t temp[], size_t n) {
+    uint32_t* origem = (uint32_t*)vetor;
+    uint32_t* destino = (uint32_t*)temp;
+    for (int deslocamento = 0; deslocamento < 32; deslocamento += 8) {
+        size_t contagem[256] = {0};
+        // O bit de sinal é invertido no último dígito para os negativos virem antes
+        uint32_t inverter = deslocamento == 24 ? 0x80u : 0;
+        for (size_t i = 0; i < n; i++)
+            contagem[((origem[i] >> deslocamento) & 0xff) ^ inverter]++;
+        size_t soma = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = contagem[d];
+            contagem[d] = soma;
+            soma += c;
+        }
+        for (size_t i = 0; i < n; i++)
+            destino[contagem[((origem[i] >> deslocamento) & 0xff) ^ inverter]++] = origem[i];
+        uint32_t* troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    // Quatro passadas: o resultado terminou de volta em 'vetor'
+}
+
+// Função para gerar execuções enchendo a memória e ordenando com radix sort
+int gerarExecucoesRadix(const char* entrada, const char* base, size_t memoria, size_t bytesBloco,
+                        long long* total) {
+    size_t capacidade = memoria / (2 * sizeof(int32_t));  // Dados + vetor temporário
+    int32_t* dados = (int32_t*)malloc(capacidade * sizeof(int32_t));
+    int32_t* temp = (int32_t*)malloc(capacidade * sizeof(int32_t));
+    if (dados == NULL || temp == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+
+    LeitorBloco* leitor = abrirLeitor(entrada, bytesBloco);
+    char nome[4096];
+    int execucoes = 0;
+    *total = 0;
+    for (;;) {
+        size_t n = 0;
+        while (n < capacidade && ler(leitor, &dados[n]))
+            n++;
+        if (n == 0)
+            break;
+        *total += n;
+        radixSort(dados, temp, n);
+
+        nomeExecucao(nome, sizeof(nome), base, 0, execucoes++);
+        EscritorDuplo* escritor = abrirEscritor(nome, bytesBloco);
+        for (size_t i = 0; i < n; i++)
+            escrever(escritor, dados[i]);
+        fecharEscritor(escritor);
+    }
+    fecharLeitor(leitor);
+    free(temp);
+    free(dados);
+    return execucoes;
+}
+
+// ---------------------------------------------------------------------------
+// Intercalação k-way com árvore de perdedores
+// ---------------------------------------------------------------------------
+
+#define FIM_EXECUCAO INT64_MAX  // Chave de uma execução esgotada
+
+// Estrutura da árvore de perdedores sobre k execuções
+// arvore[0] é o vencedor; arvore[1..k-1] são os perdedores de cada disputa.
+// As folhas (k..2k-1) são implícitas: a folha k+i é a execução i.
+typedef struct ArvorePerdedores {
+    int k;
+    int* arvore;
+    int64_t* chaves;       // Elemento atual de cada execução
+    LeitorBloco** leitores;
+} ArvorePerdedores;
+
+// Função para disputar a subárvore de 'no': grava os perdedores e retorna o vencedor
+static int disputar(ArvorePerdedores* t, int no) {
+    if (no >= t->k)
+        return no - t->k;
+    int a = disputar(t, 2 * no);
+    int b = disputar(t, 2 * no + 1);
+    if (t->chaves[b] < t->chaves[a]) {
+        t->arvore[no] = a;
+        return b;
+    }
+    t->arvore[no] = b;
+    return a;
+}
+
+// Função para avançar a execução i e refazer as disputas do caminho até a raiz
+static inline void avancarPerdedores(ArvorePerdedores* t, int i) {
+    int32_t valor;
+    t->chaves[i] = ler(t->leitores[i], &valor) ? valor : FIM_EXECUCAO;
+
+    int vencedor = i;
+    for (int no = (i + t->k) / 2; no > 0; no /= 2) {
+        if (t->chaves[t->arvore[no]] < t->chaves[vencedor]) {
+            int temp = t->arvore[no];  // O perdedor guardado vence: troca de lugar
+            t->arvore[no] = vencedor;
+            vencedor = temp;
+        }
+    }
+    t->arvore[0] = vencedor;
+}
+
+// Função para intercalar as execuções [primeira, primeira + k) em 'saida'
+void intercalar(const char* base, int passada, int primeira, int k, const char* saida, size_t bytesBloco) {
+    ArvorePerdedores t;
+    char nome[4096];
+    t.k = k;
+    t.arvore = (int*)malloc(sizeof(int) * (k > 1 ? k : 2));
+    t.chaves = (int64_t*)malloc(sizeof(int64_t) * k);
+    t.leitores = (LeitorBloco**)malloc(sizeof(LeitorBloco*) * k);
+
+    for (int i = 0; i < k; i++) {
+        int32_t valor;
+        nomeExecucao(nome, sizeof(nome), base, passada, primeira + i);
+        t.leitores[i] = abrirLeitor(nome, bytesBloco);
+        t.chaves[i] = ler(t.leitores[i], &valor) ? valor : FIM_EXECUCAO;
+    }
+    t.arvore[0] = k > 1 ? disputar(&t, 1) : 0;
+
+    EscritorDuplo* escritor = abrirEscritor(saida, bytesBloco);
+    while (t.chaves[t.arvore[0]] != FIM_EXECUCAO) {
+        int vencedor = t.arvore[0];
+        escrever(escritor, (int32_t)t.chaves[vencedor]);
+        avancarPerdedores(&t, vencedor);
+    }
+    fecharEscritor(escritor);
+
+    for (int i = 0; i < k; i++) {
+        fecharLeitor(t.leitores[i]);
+        nomeExecucao(nome, sizeof(nome), base, passada, primeira + i);
+        unlink(nome);
+    }
+    free(t.leitores);
+    free(t.chaves);
+    free(t.arvore);
+}
+
+// ---------------------------------------------------------------------------
+// Ordenação completa
+// ---------------------------------------------------------------------------
+
+#define GERACAO_SUBSTITUICAO 0  // Seleção por substituição (execuções ~2x maiores)
+#define GERACAO_RADIX 1         // Encher, ordenar e gravar (geração mais rápida)
+
+// Estrutura com as medidas de uma ordenação
+typedef struct EstatisticasOrdenacao {
+    long long elementos;
+    int execucoes;
+    int passadas;         // Passadas de intercalação (a última grava a saída)
+    int grau;             // Máximo de execuções intercaladas por vez
+    double segundosGeracao;
+    double segundosIntercalacao;
+} EstatisticasOrdenacao;
+
+static double agoraSegundos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Função para ordenar 'entrada' em 'saida' usando até 'memoria' bytes
+// As execuções temporárias ficam ao lado da saída (saida.execP_I) e são apagadas
+void ordenarArquivo(const char* entrada, const char* saida, size_t memoria, int geracao,
+                    EstatisticasOrdenacao* est) {
+    // Blocos de E/S: até 1 MB, e pelo menos 8 blocos cabendo no orçamento
+    size_t bytesBloco = BLOCO_MAXIMO;
+    while (bytesBloco > 4096 && bytesBloco * 8 > memoria)
+        bytesBloco /= 2;
+    // Na intercalação, cada execução usa um bloco e a saída usa dois
+    int grau = (int)(memoria / bytesBloco) - 2;
+    if (grau < 2)
+        grau = 2;
+    // Na geração, a entrada usa um bloco e a execução sendo gravada usa dois
+    size_t memoriaGeracao = memoria > 4 * bytesBloco ? memoria - 3 * bytesBloco : bytesBloco;
+
+    memset(est, 0, sizeof(*est));
+    est->grau = grau;
+    double inicio = agoraSegundos();
+    if (geracao == GERACAO_RADIX)
+        est->execucoes = gerarExecucoesRadix(entrada, saida, memoriaGeracao, bytesBloco, &est->elementos);
+    else
+        est->execucoes = gerarExecucoes(entrada, saida, memoriaGeracao, bytesBloco, &est->elementos);
+    est->segundosGeracao = agoraSegundos() - inicio;
+
+    inicio = agoraSegundos();
+    char nome[4096];
+    int execucoes = est->execucoes;
+    int passada = 0;
+    if (execucoes == 0) {  // Entrada vazia
+        close(open(saida, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    }
+    while (execucoes > 0) {
+        est->passadas++;
+        if (execucoes <= grau) {
+            intercalar(saida, passada, 0, execucoes, saida, bytesBloco);
+            break;
+        }
+        // Passada intermediária: grupos de 'grau' execuções viram execuções da próxima passada
+        int novas = 0;
+        for (int primeira = 0; primeira < execucoes; primeira += grau) {
+            int k = execucoes - primeira < grau ? execucoes - primeira : grau;
+            nomeExecucao(nome, sizeof(nome), saida, passada + 1, novas++);
+            intercalar(saida, passada, primeira, k, nome, bytesBloco);
+        }
+        execucoes = novas;
+        passada++;
+    }
+    est->segundosIntercalacao = agoraSegundos() - inicio;
+}
+
+// Função para gerar um arquivo de n inteiros aleatórios
+void gerarArquivoAleatorio(const char* caminho, long long n, uint64_t semente) {
+    EscritorDuplo* e = abrirEscritor(caminho, BLOCO_MAXIMO);
+    for (long long i = 0; i < n; i++) {
+        semente ^= semente << 13;
+        semente ^= semente >> 7;
+        semente ^= semente << 17;
+        escrever(e, (int32_t)(semente >> 32));
+    }
+    fecharEscritor(e);
+}
+
+// Função para conferir se o arquivo está em ordem crescente; retorna quantos inteiros tem
+long long verificarOrdenado(const char* caminho, int* ordenado) {
+    LeitorBloco* l = abrirLeitor(caminho, BLOCO_MAXIMO);
+    long long n = 0;
+    int32_t anterior = INT32_MIN, valor;
+    *ordenado = 1;
+    while (ler(l, &valor)) {
+        if (valor < anterior)
+            *ordenado = 0;
+        anterior = valor;
+        n++;
+    }
+    fecharLeitor(l);
+    return n;
+}
+
+#ifdef BENCHMARK
+// Benchmark de vazão (gcc -O2 -pthread -DBENCHMARK OrdenacaoExterna.c -lm)
+// Uso: ./bench [tamanho_MB] [memoria_MB ...]  (padrão 1024 MB, memórias 16 64 256)
+// Gera o arquivo em $TMPDIR, tira-o do cache antes de cada ordenação e mede MB/s
+int main(int argc, char* argv[]) {
+    long long megabytes = argc > 1 ? atoll(argv[1]) : 1024;
+    int padrao[] = {16, 64, 256};
+    int quantas = argc > 2 ? argc - 2 : 3;
+    const char* dir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+    char entrada[4096], saida[4096];
+    snprintf(entrada, sizeof(entrada), "%s/ordenacao_externa_%d.bin", dir, (int)getpid());
+    snprintf(saida, sizeof(saida), "%s/ordenacao_externa_%d.ord", dir, (int)getpid());
+
+    long long n = megabytes * (1 << 20) / (long long)sizeof(int32_t);
+    gerarArquivoAleatorio(entrada, n, 88172645463325252ULL);
+
+    printf("geracao,tamanho_mb,memoria_mb,execucoes,grau,passadas,geracao_mb_s,intercalacao_mb_s,total_mb_s,ok\n");
+    for (int i = 0; i < 2 * quantas; i++) {
+        int memoria = argc > 2 ? atoi(argv[i / 2 + 2]) : padrao[i / 2];
+        int geracao = i % 2 ? GERACAO_RADIX : GERACAO_SUBSTITUICAO;
+        int fd = open(entrada, O_RDONLY);  // Tira a entrada do cache de páginas
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+
+        EstatisticasOrdenacao est;
+        ordenarArquivo(entrada, saida, (size_t)memoria << 20, geracao, &est);
+        int ordenado;
+        long long lidos = verificarOrdenado(saida, &ordenado);
+        double total = est.segundosGeracao + est.segundosIntercalacao;
+        printf("%s,%lld,%d,%d,%d,%d,%.1f,%.1f,%.1f,%d\n", geracao ? "radix" : "substituicao", megabytes, memoria, est.execucoes, est.grau, est.passadas,
+               megabytes / est.segundosGeracao, megabytes / est.segundosIntercalacao, megabytes / total,
+               ordenado && lidos == n);
+    }
+    unlink(entrada);
+    unlink(saida);
+    return 0;
+}
+#else
+int main(int argc, char* argv[]) {
+    EstatisticasOrdenacao est;
+
+    if (argc >= 3) {
+        size_t memoria = (size_t)(argc > 3 ? atoi(argv[3]) : 256) << 20;
+        int geracao = argc > 4 && !strcmp(argv[4], "radix") ? GERACAO_RADIX : GERACAO_SUBSTITUICAO;
+        ordenarArquivo(argv[1], argv[2], memoria, geracao, &est);
+        printf("%lld inteiros, %d execuções, %d passada(s) de intercalação, %.2f s\n", est.elementos,
+               est.execucoes, est.passadas, est.segundosGeracao + est.segundosIntercalacao);
+        return 0;
+    }
+
+    // Demonstração: 1 milhão de inteiros com 64 KB de memória força várias passadas
+    const char* entrada = "demo_ordenacao.bin";
+    const char* saida = "demo_ordenacao.ord";
+    gerarArquivoAleatorio(entrada, 1000000, 12345);
+    for (int geracao = GERACAO_SUBSTITUICAO; geracao <= GERACAO_RADIX; geracao++) {
+        ordenarArquivo(entrada, saida, 64 << 10, geracao, &est);
+
+        int ordenado;
+        long long n = verificarOrdenado(saida, &ordenado);
+        printf("%s\n", geracao == GERACAO_RADIX ? "Geração com radix sort:" : "Seleção por substituição:");
+        printf("  Elementos: %lld\n", est.elementos);
+        printf("  Execuções geradas: %d (média de %lld elementos)\n", est.execucoes,
+               est.elementos / (est.execucoes ? est.execucoes : 1));
+        printf("  Grau da intercalação: %d, passadas: %d\n", est.grau, est.passadas);
+        printf("  Saída com %lld elementos, %s\n", n, ordenado ? "em ordem crescente" : "FORA DE ORDEM");
+    }
+
+    unlink(entrada);
+    unlink(saida);
+    return 0;
+}
+#endif
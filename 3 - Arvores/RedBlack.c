@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "snapshot.h"  // Formato binário para salvar e carregar a árvore
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
 // Definição dos possíveis valores de cor
 #define VERMELHO 0
@@ -175,6 +179,117 @@ void imprimeArvoreRB(No *raiz, int b)
     }
 }
 
+// Acesso do snapshot (snapshot.h) aos nós desta árvore; a cor vai como dado auxiliar
+void *esquerdaSnapshot(const void *no)
+{
+    return ((const No *)no)->esquerda;
+}
+
+void *direitaSnapshot(const void *no)
+{
+    return ((const No *)no)->direita;
+}
+
+int32_t chaveSnapshot(const void *no)
+{
+    return ((const No *)no)->valor;
+}
+
+uint8_t corSnapshot(const void *no)
+{
+    return (uint8_t)((const No *)no)->cor;
+}
+
+void *criarSnapshot(int32_t chave, uint8_t cor)
+{
+    No *novoNo = criarNo(chave);
+    novoNo->cor = cor;
+    return novoNo;
+}
+
+void ligarSnapshot(void *pai, void *filho, int direita)
+{
+    if (direita)
+        ((No *)pai)->direita = (No *)filho;
+    else
+        ((No *)pai)->esquerda = (No *)filho;
+    ((No *)filho)->pai = (No *)pai;
+}
+
+void liberarSnapshot(void *no)
+{
+    free(no);
+}
+
+static const AcessoSnapshot acessoSnapshot = {SNAPSHOT_REDBLACK, esquerdaSnapshot, direitaSnapshot, chaveSnapshot,
+                                              corSnapshot, criarSnapshot, ligarSnapshot, liberarSnapshot};
+
+// Função para salvar a árvore em um snapshot binário; retorna os nós gravados ou -1
+long long salvarArvore(No *raiz, const char *caminho)
+{
+    return salvarSnapshot(raiz, caminho, &acessoSnapshot);
+}
+
+// Função para carregar uma árvore salva por salvarArvore, com as cores e os pais
+No *carregarArvore(const char *caminho)
+{
+    return (No *)carregarSnapshot(caminho, &acessoSnapshot);
+}
+
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK RedBlack.c -lm)
+// A árvore Red-Black não tem remoção, então a mistura só busca e insere
+void *benchCriar(void)
+{
+    return calloc(1, sizeof(No *));
+}
+
+void benchInserir(void *estrutura, int chave)
+{
+    inserir((No **)estrutura, chave);
+}
+
+int benchBuscar(void *estrutura, int chave)
+{
+    No *atual = *(No **)estrutura;
+    while (atual != NULL && atual->valor != chave)
+        atual = (chave < atual->valor) ? atual->esquerda : atual->direita;
+    return atual != NULL;
+}
+
+int benchNiveis(No *raiz)
+{
+    if (raiz == NULL)
+        return 0;
+    int esquerda = benchNiveis(raiz->esquerda);
+    int direita = benchNiveis(raiz->direita);
+    return 1 + (esquerda > direita ? esquerda : direita);
+}
+
+int benchAltura(void *estrutura)
+{
+    return benchNiveis(*(No **)estrutura);
+}
+
+long long benchSalvar(void *estrutura, const char *caminho)
+{
+    return salvarArvore(*(No **)estrutura, caminho);
+}
+
+void *benchCarregar(const char *caminho)
+{
+    No **raiz = (No **)calloc(1, sizeof(No *));
+    *raiz = carregarArvore(caminho);
+    return raiz;
+}
+
+int main(int argc, char *argv[])
+{
+    AdaptadorBench adaptador = {"redblack", benchCriar, benchInserir, benchBuscar, NULL, benchAltura,
+                                benchSalvar, benchCarregar};
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main()
 {
     struct No *raiz = NULL;
@@ -187,5 +302,15 @@ int main()
     imprimeArvoreRB(raiz, 3);
     printf("\n");
 
+    // Snapshot binário: salva e recarrega com a mesma forma e as mesmas cores
+    if (salvarArvore(raiz, "redblack.snapshot") >= 0)
+    {
+        raiz = carregarArvore("redblack.snapshot");
+        printf("Árvore Red-Black recarregada do snapshot: \n");
+        imprimeArvoreRB(raiz, 3);
+        remove("redblack.snapshot");
+    }
+
     return 0;
 }
+#endif
@@ -1,5 +1,11 @@
 #include <stdio.h>   // Inclui a biblioteca padrão de entrada e saída
 #include <stdlib.h>  // Inclui a biblioteca padrão de alocação de memória
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>   // Construção paralela (compilar com -pthread)
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece os temporizadores
+#endif
 
 // Estrutura de um nó da árvore binária
 typedef struct NoArvore {
@@ -8,6 +14,9 @@ typedef struct NoArvore {
     struct NoArvore* direita;   // Ponteiro para o filho à direita
 } NoArvore;
 
+// Função chamada pelas travessias para cada nó visitado
+typedef void (*Visitante)(NoArvore* no, void* contexto);
+
 // Estrutura para a pilha usada nas travessias iterativas
 typedef struct Pilha {
     NoArvore* no;       // Ponteiro para um nó da árvore
@@ -130,35 +139,41 @@ NoArvore* pop(Pilha** topo) {
     return desempilhado;  // Retorna o nó desempilhado
 }
 
+// Visitante padrão: imprime o valor do nó
+void imprimirNo(NoArvore* no, void* contexto) {
+    (void)contexto;
+    printf("%d ", no->dado);
+}
+
 // Travessia Pré-Ordem Recursiva
-void preOrdemRec(NoArvore* raiz) {
+void preOrdemRec(NoArvore* raiz, Visitante visitar, void* contexto) {
     if (raiz != NULL) {  // Se o nó não é nulo
-        printf("%d ", raiz->dado);  // Imprime o valor do nó
-        preOrdemRec(raiz->esquerda);  // Visita recursivamente a subárvore esquerda
-        preOrdemRec(raiz->direita);   // Visita recursivamente a subárvore direita
+        visitar(raiz, contexto);  // Visita o nó
+        preOrdemRec(raiz->esquerda, visitar, contexto);  // Visita recursivamente a subárvore esquerda
+        preOrdemRec(raiz->direita, visitar, contexto);   // Visita recursivamente a subárvore direita
     }
 }
 
 // Travessia Em Ordem Recursiva
-void emOrdemRec(NoArvore* raiz) {
+void emOrdemRec(NoArvore* raiz, Visitante visitar, void* contexto) {
     if (raiz != NULL) {  // Se o nó não é nulo
-        emOrdemRec(raiz->esquerda);  // Visita recursivamente a subárvore esquerda
-        printf("%d ", raiz->dado);  // Imprime o valor do nó
-        emOrdemRec(raiz->direita);   // Visita recursivamente a subárvore direita
+        emOrdemRec(raiz->esquerda, visitar, contexto);  // Visita recursivamente a subárvore esquerda
+        visitar(raiz, contexto);  // Visita o nó
+        emOrdemRec(raiz->direita, visitar, contexto);   // Visita recursivamente a subárvore direita
     }
 }
 
 // Travessia Pós-Ordem Recursiva
-void posOrdemRec(NoArvore* raiz) {
+void posOrdemRec(NoArvore* raiz, Visitante visitar, void* contexto) {
     if (raiz != NULL) {  // Se o nó não é nulo
-        posOrdemRec(raiz->esquerda);  // Visita recursivamente a subárvore esquerda
-        posOrdemRec(raiz->direita);   // Visita recursivamente a subárvore direita
-        printf("%d ", raiz->dado);   // Imprime o valor do nó
+        posOrdemRec(raiz->esquerda, visitar, contexto);  // Visita recursivamente a subárvore esquerda
+        posOrdemRec(raiz->direita, visitar, contexto);   // Visita recursivamente a subárvore direita
+        visitar(raiz, contexto);   // Visita o nó
     }
 }
 
 // Travessia Pré-Ordem Iterativa
-void preOrdemIt(NoArvore* raiz) {
+void preOrdemIt(NoArvore* raiz, Visitante visitar, void* contexto) {
     if (raiz == NULL) return;  // Se a árvore estiver vazia, retorna
     
     Pilha* pilha = NULL;  // Inicializa uma pilha vazia
@@ -166,7 +181,7 @@ void preOrdemIt(NoArvore* raiz) {
     
     while (pilha != NULL) {  // Enquanto a pilha não estiver vazia
         NoArvore* atual = pop(&pilha);  // Desempilha o nó do topo
-        printf("%d ", atual->dado);      // Imprime o valor do nó
+        visitar(atual, contexto);        // Visita o nó
         
         // Empilha o nó direito se ele existir
         if (atual->direita != NULL) {
@@ -180,7 +195,7 @@ void preOrdemIt(NoArvore* raiz) {
 }
 
 // Travessia Em Ordem Iterativa
-void emOrdemIt(NoArvore* raiz) {
+void emOrdemIt(NoArvore* raiz, Visitante visitar, void* contexto) {
     Pilha* pilha = NULL;  // Inicializa uma pilha vazia
     NoArvore* atual = raiz;  // Começa pelo nó raiz
     
@@ -193,7 +208,7 @@ void emOrdemIt(NoArvore* raiz) {
         
         // Processa o nó no topo da pilha
         atual = pop(&pilha);
-        printf("%d ", atual->dado);
+        visitar(atual, contexto);
         
         // Move-se para a subárvore direita
         atual = atual->direita;
@@ -201,7 +216,7 @@ void emOrdemIt(NoArvore* raiz) {
 }
 
 // Travessia Pós-Ordem Iterativa
-void posOrdemIt(NoArvore* raiz) {
+void posOrdemIt(NoArvore* raiz, Visitante visitar, void* contexto) {
     if (raiz == NULL) return;  // Se a árvore estiver vazia, retorna
     
     Pilha* pilha1 = NULL;  // Inicializa a primeira pilha
@@ -222,13 +237,707 @@ void posOrdemIt(NoArvore* raiz) {
         }
     }
     
-    // Imprime os nós na ordem da segunda pilha
+    // Visita os nós na ordem da segunda pilha
     while (pilha2 != NULL) {
         NoArvore* atual = pop(&pilha2);
-        printf("%d ", atual->dado);
+        visitar(atual, contexto);
+    }
+}
+
+// Estrutura para a pilha em vetor usada pelas travessias sem alocação
+// A capacidade acompanha a altura da árvore e o vetor é reaproveitado entre chamadas
+typedef struct PilhaVetor {
+    NoArvore** itens;   // Vetor de ponteiros para nós
+    int topo;           // Quantidade de itens empilhados
+    int capacidade;     // Tamanho do vetor
+} PilhaVetor;
+
+// Função para criar uma pilha em vetor (capacidade inicial = altura esperada + 1)
+PilhaVetor* criarPilhaVetor(int capacidade) {
+    PilhaVetor* pilha = (PilhaVetor*)malloc(sizeof(PilhaVetor));
+    if (capacidade < 16)
+        capacidade = 16;
+    pilha->itens = (NoArvore**)malloc(sizeof(NoArvore*) * capacidade);
+    pilha->topo = 0;
+    pilha->capacidade = capacidade;
+    return pilha;
+}
+
+// Função para liberar a pilha em vetor
+void liberarPilhaVetor(PilhaVetor* pilha) {
+    free(pilha->itens);
+    free(pilha);
+}
+
+// Função para dobrar a pilha; só acontece se a árvore for mais alta que a capacidade
+void crescerPilhaVetor(PilhaVetor* pilha) {
+    pilha->capacidade *= 2;
+    pilha->itens = (NoArvore**)realloc(pilha->itens, sizeof(NoArvore*) * pilha->capacidade);
+    if (pilha->itens == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+}
+
+// Empilha sem alocar (exceto no raro crescimento)
+static inline void empilharVetor(PilhaVetor* pilha, NoArvore* no) {
+    if (pilha->topo == pilha->capacidade)
+        crescerPilhaVetor(pilha);
+    pilha->itens[pilha->topo++] = no;
+}
+
+// Travessia Pré-Ordem com pilha em vetor
+void preOrdemPilha(NoArvore* raiz, PilhaVetor* pilha, Visitante visitar, void* contexto) {
+    if (raiz == NULL) return;  // Se a árvore estiver vazia, retorna
+
+    pilha->topo = 0;
+    empilharVetor(pilha, raiz);
+    while (pilha->topo > 0) {
+        NoArvore* atual = pilha->itens[--pilha->topo];  // Desempilha o nó do topo
+        visitar(atual, contexto);
+
+        // Direita antes da esquerda para que a esquerda seja visitada primeiro
+        if (atual->direita != NULL)
+            empilharVetor(pilha, atual->direita);
+        if (atual->esquerda != NULL)
+            empilharVetor(pilha, atual->esquerda);
+    }
+}
+
+// Travessia Em Ordem com pilha em vetor
+void emOrdemPilha(NoArvore* raiz, PilhaVetor* pilha, Visitante visitar, void* contexto) {
+    NoArvore* atual = raiz;
+
+    pilha->topo = 0;
+    while (atual != NULL || pilha->topo > 0) {
+        // Vai até o nó mais à esquerda da subárvore
+        while (atual != NULL) {
+            empilharVetor(pilha, atual);
+            atual = atual->esquerda;
+        }
+
+        atual = pilha->itens[--pilha->topo];
+        visitar(atual, contexto);
+        atual = atual->direita;  // Move-se para a subárvore direita
+    }
+}
+
+// Travessia Pós-Ordem com uma única pilha em vetor
+// Guarda o último nó visitado para saber se a subárvore direita já foi processada
+void posOrdemPilha(NoArvore* raiz, PilhaVetor* pilha, Visitante visitar, void* contexto) {
+    NoArvore* atual = raiz;
+    NoArvore* ultimo = NULL;
+
+    pilha->topo = 0;
+    while (atual != NULL || pilha->topo > 0) {
+        if (atual != NULL) {
+            empilharVetor(pilha, atual);
+            atual = atual->esquerda;
+        } else {
+            NoArvore* topo = pilha->itens[pilha->topo - 1];
+            if (topo->direita != NULL && ultimo != topo->direita) {
+                atual = topo->direita;  // Processa a subárvore direita primeiro
+            } else {
+                visitar(topo, contexto);
+                ultimo = topo;
+                pilha->topo--;
+            }
+        }
+    }
+}
+
+// Travessia Em Ordem de Morris: memória extra O(1)
+// Usa temporariamente o ponteiro direito do predecessor como "fio" de volta;
+// a árvore é restaurada ao final, mas não pode ser lida por outra thread durante a travessia
+void emOrdemMorris(NoArvore* raiz, Visitante visitar, void* contexto) {
+    NoArvore* atual = raiz;
+
+    while (atual != NULL) {
+        if (atual->esquerda == NULL) {
+            visitar(atual, contexto);
+            atual = atual->direita;
+        } else {
+            // Encontra o predecessor em ordem (mais à direita da subárvore esquerda)
+            NoArvore* predecessor = atual->esquerda;
+            while (predecessor->direita != NULL && predecessor->direita != atual)
+                predecessor = predecessor->direita;
+
+            if (predecessor->direita == NULL) {
+                predecessor->direita = atual;  // Cria o fio
+                atual = atual->esquerda;
+            } else {
+                predecessor->direita = NULL;   // Remove o fio
+                visitar(atual, contexto);
+                atual = atual->direita;
+            }
+        }
+    }
+}
+
+// Travessia Pré-Ordem de Morris: igual à em ordem, mas visita ao criar o fio
+void preOrdemMorris(NoArvore* raiz, Visitante visitar, void* contexto) {
+    NoArvore* atual = raiz;
+
+    while (atual != NULL) {
+        if (atual->esquerda == NULL) {
+            visitar(atual, contexto);
+            atual = atual->direita;
+        } else {
+            NoArvore* predecessor = atual->esquerda;
+            while (predecessor->direita != NULL && predecessor->direita != atual)
+                predecessor = predecessor->direita;
+
+            if (predecessor->direita == NULL) {
+                visitar(atual, contexto);
+                predecessor->direita = atual;
+                atual = atual->esquerda;
+            } else {
+                predecessor->direita = NULL;
+                atual = atual->direita;
+            }
+        }
+    }
+}
+
+// Função auxiliar para inverter a cadeia de ponteiros direitos de 'de' até 'ate'
+void inverterCaminhoDireito(NoArvore* de, NoArvore* ate) {
+    if (de == ate) return;
+    NoArvore* anterior = de;
+    NoArvore* atual = de->direita;
+    while (anterior != ate) {
+        NoArvore* proximo = atual->direita;
+        atual->direita = anterior;
+        anterior = atual;
+        atual = proximo;
+    }
+}
+
+// Travessia Pós-Ordem de Morris
+// Ao remover um fio, visita de baixo para cima a borda direita da subárvore esquerda
+// (invertendo a cadeia, visitando e desinvertendo); um nó auxiliar cobre a raiz
+void posOrdemMorris(NoArvore* raiz, Visitante visitar, void* contexto) {
+    NoArvore auxiliar;
+    auxiliar.esquerda = raiz;
+    auxiliar.direita = NULL;
+    NoArvore* atual = &auxiliar;
+
+    while (atual != NULL) {
+        if (atual->esquerda == NULL) {
+            atual = atual->direita;
+        } else {
+            NoArvore* predecessor = atual->esquerda;
+            while (predecessor->direita != NULL && predecessor->direita != atual)
+                predecessor = predecessor->direita;
+
+            if (predecessor->direita == NULL) {
+                predecessor->direita = atual;
+                atual = atual->esquerda;
+            } else {
+                inverterCaminhoDireito(atual->esquerda, predecessor);
+                NoArvore* no = predecessor;
+                while (1) {
+                    NoArvore* proximo = no->direita;  // Salva antes da visita
+                    visitar(no, contexto);
+                    if (no == atual->esquerda) break;
+                    no = proximo;
+                }
+                inverterCaminhoDireito(predecessor, atual->esquerda);
+                predecessor->direita = NULL;  // Remove o fio
+                atual = atual->direita;
+            }
+        }
     }
 }
 
+// ---------------------------------------------------------------------------
+// Árvore costurada (threaded): ponteiros nulos viram "fios" em ordem
+// ---------------------------------------------------------------------------
+
+// Estrutura de um nó da árvore costurada
+// Quando não há filho, o ponteiro aponta para o predecessor (esquerda) ou o
+// sucessor (direita) em ordem e a flag correspondente marca que é um fio.
+// As flags ocupam o preenchimento após 'dado', então o nó tem o mesmo tamanho de NoArvore.
+typedef struct NoCosturado {
+    int dado;                       // Valor armazenado no nó
+    unsigned char fioEsquerda;      // 1 se 'esquerda' é fio para o predecessor
+    unsigned char fioDireita;       // 1 se 'direita' é fio para o sucessor
+    struct NoCosturado* esquerda;   // Filho esquerdo ou fio
+    struct NoCosturado* direita;    // Filho direito ou fio
+} NoCosturado;
+
+typedef void (*VisitanteCosturado)(NoCosturado* no, void* contexto);
+
+// Função para criar um nó costurado (sem filhos: os dois ponteiros são fios)
+NoCosturado* criarNoCosturado(int dado) {
+    NoCosturado* novoNo = (NoCosturado*)malloc(sizeof(NoCosturado));
+    if (novoNo == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    novoNo->dado = dado;
+    novoNo->fioEsquerda = 1;
+    novoNo->fioDireita = 1;
+    novoNo->esquerda = NULL;
+    novoNo->direita = NULL;
+    return novoNo;
+}
+
+// Função para encontrar o primeiro nó em ordem (menor valor)
+NoCosturado* primeiroCosturado(NoCosturado* raiz) {
+    if (raiz == NULL) return NULL;
+    while (!raiz->fioEsquerda)
+        raiz = raiz->esquerda;
+    return raiz;
+}
+
+// Função para encontrar o último nó em ordem (maior valor)
+NoCosturado* ultimoCosturado(NoCosturado* raiz) {
+    if (raiz == NULL) return NULL;
+    while (!raiz->fioDireita)
+        raiz = raiz->direita;
+    return raiz;
+}
+
+// Função para avançar ao sucessor em ordem: O(1) amortizado, sem pilha
+NoCosturado* sucessorCosturado(NoCosturado* no) {
+    if (no->fioDireita)
+        return no->direita;  // Segue o fio
+    return primeiroCosturado(no->direita);  // Menor da subárvore direita
+}
+
+// Função para voltar ao predecessor em ordem: O(1) amortizado, sem pilha
+NoCosturado* predecessorCosturado(NoCosturado* no) {
+    if (no->fioEsquerda)
+        return no->esquerda;
+    return ultimoCosturado(no->esquerda);
+}
+
+// Travessia Em Ordem pelos fios (sem pilha e sem alocação)
+void emOrdemCosturada(NoCosturado* raiz, VisitanteCosturado visitar, void* contexto) {
+    for (NoCosturado* no = primeiroCosturado(raiz); no != NULL; no = sucessorCosturado(no))
+        visitar(no, contexto);
+}
+
+// Travessia Em Ordem reversa pelos fios
+void emOrdemReversaCosturada(NoCosturado* raiz, VisitanteCosturado visitar, void* contexto) {
+    for (NoCosturado* no = ultimoCosturado(raiz); no != NULL; no = predecessorCosturado(no))
+        visitar(no, contexto);
+}
+
+// Função para buscar um elemento na árvore costurada
+NoCosturado* buscarCosturado(NoCosturado* raiz, int dado) {
+    NoCosturado* atual = raiz;
+    while (atual != NULL) {
+        if (dado == atual->dado)
+            return atual;
+        if (dado < atual->dado) {
+            if (atual->fioEsquerda) return NULL;
+            atual = atual->esquerda;
+        } else {
+            if (atual->fioDireita) return NULL;
+            atual = atual->direita;
+        }
+    }
+    return NULL;
+}
+
+// Função para inserir na árvore costurada (valores repetidos são ignorados)
+// O novo nó herda o fio do pai: fica entre o pai e o antigo predecessor/sucessor dele
+NoCosturado* inserirCosturado(NoCosturado* raiz, int dado) {
+    NoCosturado* pai = NULL;
+    NoCosturado* atual = raiz;
+
+    // Desce até o ponto de inserção
+    while (atual != NULL) {
+        if (dado == atual->dado)
+            return raiz;
+        pai = atual;
+        if (dado < atual->dado) {
+            if (atual->fioEsquerda) break;
+            atual = atual->esquerda;
+        } else {
+            if (atual->fioDireita) break;
+            atual = atual->direita;
+        }
+    }
+
+    NoCosturado* novoNo = criarNoCosturado(dado);
+    if (pai == NULL)  // Árvore vazia
+        return novoNo;
+
+    if (dado < pai->dado) {
+        novoNo->esquerda = pai->esquerda;  // Predecessor do pai vira o predecessor do novo nó
+        novoNo->direita = pai;             // O pai é o sucessor
+        pai->fioEsquerda = 0;
+        pai->esquerda = novoNo;
+    } else {
+        novoNo->direita = pai->direita;    // Sucessor do pai vira o sucessor do novo nó
+        novoNo->esquerda = pai;            // O pai é o predecessor
+        pai->fioDireita = 0;
+        pai->direita = novoNo;
+    }
+    return raiz;
+}
+
+// Função auxiliar para remover um nó com no máximo um filho, refazendo os fios
+NoCosturado* removerComUmFilho(NoCosturado* raiz, NoCosturado* pai, NoCosturado* no) {
+    if (no->fioEsquerda && no->fioDireita) {
+        // Caso 1: nó folha - o pai passa a ter um fio no lugar do filho
+        if (pai == NULL)
+            raiz = NULL;
+        else if (no == pai->esquerda) {
+            pai->fioEsquerda = 1;
+            pai->esquerda = no->esquerda;
+        } else {
+            pai->fioDireita = 1;
+            pai->direita = no->direita;
+        }
+    } else {
+        // Caso 2: um filho - o filho sobe e o fio que apontava para o nó é corrigido
+        NoCosturado* filho = no->fioEsquerda ? no->direita : no->esquerda;
+        NoCosturado* sucessor = sucessorCosturado(no);
+        NoCosturado* predecessor = predecessorCosturado(no);
+
+        if (pai == NULL)
+            raiz = filho;
+        else if (no == pai->esquerda)
+            pai->esquerda = filho;
+        else
+            pai->direita = filho;
+
+        if (!no->fioEsquerda)
+            predecessor->direita = sucessor;  // Predecessor está na subárvore esquerda
+        else
+            sucessor->esquerda = predecessor; // Sucessor está na subárvore direita
+    }
+    free(no);
+    return raiz;
+}
+
+// Função para excluir um valor da árvore costurada
+NoCosturado* excluirCosturado(NoCosturado* raiz, int dado) {
+    NoCosturado* pai = NULL;
+    NoCosturado* atual = raiz;
+
+    // Procura o nó e o seu pai
+    while (atual != NULL && atual->dado != dado) {
+        pai = atual;
+        if (dado < atual->dado) {
+            if (atual->fioEsquerda) return raiz;  // Não encontrado
+            atual = atual->esquerda;
+        } else {
+            if (atual->fioDireita) return raiz;
+            atual = atual->direita;
+        }
+    }
+    if (atual == NULL)
+        return raiz;
+
+    if (!atual->fioEsquerda && !atual->fioDireita) {
+        // Caso 3: dois filhos - copia o sucessor (menor da subárvore direita) e remove-o
+        NoCosturado* paiSucessor = atual;
+        NoCosturado* sucessor = atual->direita;
+        while (!sucessor->fioEsquerda) {
+            paiSucessor = sucessor;
+            sucessor = sucessor->esquerda;
+        }
+        atual->dado = sucessor->dado;
+        return removerComUmFilho(raiz, paiSucessor, sucessor);
+    }
+    return removerComUmFilho(raiz, pai, atual);
+}
+
+// Função para criar uma árvore costurada balanceada a partir de um vetor ordenado
+// 'predecessor' e 'sucessor' são os destinos dos fios nas bordas da subárvore
+NoCosturado* inserirElementosCosturados(int vetor[], int inicio, int fim,
+                                        NoCosturado* predecessor, NoCosturado* sucessor) {
+    if (inicio > fim)
+        return NULL;
+
+    int meio = (inicio + fim) / 2;
+    NoCosturado* novoNo = criarNoCosturado(vetor[meio]);
+
+    NoCosturado* esquerda = inserirElementosCosturados(vetor, inicio, meio - 1, predecessor, novoNo);
+    if (esquerda != NULL) {
+        novoNo->esquerda = esquerda;
+        novoNo->fioEsquerda = 0;
+    } else {
+        novoNo->esquerda = predecessor;
+    }
+
+    NoCosturado* direita = inserirElementosCosturados(vetor, meio + 1, fim, novoNo, sucessor);
+    if (direita != NULL) {
+        novoNo->direita = direita;
+        novoNo->fioDireita = 0;
+    } else {
+        novoNo->direita = sucessor;
+    }
+    return novoNo;
+}
+
+// Visitante padrão da árvore costurada: imprime o valor do nó
+void imprimirNoCosturado(NoCosturado* no, void* contexto) {
+    (void)contexto;
+    printf("%d ", no->dado);
+}
+
+// ---------------------------------------------------------------------------
+// Construção paralela da árvore balanceada a partir de um vetor ordenado
+// ---------------------------------------------------------------------------
+
+// As duas metades de inserirElementos são independentes. Os níveis de cima são
+// montados pela thread principal até as subárvores caberem no grão; cada
+// subárvore vira uma tarefa, e as threads pegam tarefas de um contador atômico.
+// Os nós não usam malloc: o nó de vetor[i] é nos[i] num único bloco, então
+// cada tarefa escreve uma fatia contígua e disjunta do bloco (e é a thread que
+// a monta quem toca primeiro aquelas páginas).
+
+#define GRAO_CONSTRUCAO 65536  // Nós por tarefa
+
+// Estrutura de uma tarefa: montar vetor[inicio..fim] e ligar a raiz em *destino
+typedef struct TarefaConstrucao {
+    int inicio, fim;
+    NoArvore** destino;
+} TarefaConstrucao;
+
+// Estrutura compartilhada pelas threads da construção
+typedef struct ConstrucaoParalela {
+    const int* vetor;
+    NoArvore* nos;               // Bloco com um nó por elemento do vetor
+    TarefaConstrucao* tarefas;
+    int numTarefas, capacidade;
+    atomic_int proxima;          // Próxima tarefa a ser pega
+} ConstrucaoParalela;
+
+// Função para montar sequencialmente a subárvore de vetor[inicio..fim] em nos[inicio..fim]
+NoArvore* construirNoBloco(const int vetor[], NoArvore nos[], int inicio, int fim) {
+    if (inicio > fim)
+        return NULL;
+
+    int meio = inicio + (fim - inicio) / 2;  // Mesmo meio de inserirElementos, sem estouro
+    NoArvore* no = &nos[meio];
+    no->dado = vetor[meio];
+    no->esquerda = construirNoBloco(vetor, nos, inicio, meio - 1);
+    no->direita = construirNoBloco(vetor, nos, meio + 1, fim);
+    return no;
+}
+
+// Função para montar os níveis de cima e enfileirar as subárvores do tamanho do grão
+void dividirConstrucao(ConstrucaoParalela* c, int inicio, int fim, NoArvore** destino, int grao) {
+    if (inicio > fim) {
+        *destino = NULL;
+        return;
+    }
+    if (fim - inicio + 1 <= grao) {
+        if (c->numTarefas == c->capacidade) {
+            c->capacidade *= 2;
+            c->tarefas = (TarefaConstrucao*)realloc(c->tarefas, sizeof(TarefaConstrucao) * c->capacidade);
+            if (c->tarefas == NULL) {
+                printf("Erro: Falha na alocação de memória.\n");
+                exit(-1);
+            }
+        }
+        c->tarefas[c->numTarefas].inicio = inicio;
+        c->tarefas[c->numTarefas].fim = fim;
+        c->tarefas[c->numTarefas].destino = destino;
+        c->numTarefas++;
+        return;
+    }
+
+    int meio = inicio + (fim - inicio) / 2;
+    NoArvore* no = &c->nos[meio];
+    no->dado = c->vetor[meio];
+    *destino = no;
+    dividirConstrucao(c, inicio, meio - 1, &no->esquerda, grao);
+    dividirConstrucao(c, meio + 1, fim, &no->direita, grao);
+}
+
+// Função executada por cada thread: pega tarefas até acabarem
+void* trabalhadorConstrucao(void* arg) {
+    ConstrucaoParalela* c = (ConstrucaoParalela*)arg;
+    int t;
+    while ((t = atomic_fetch_add(&c->proxima, 1)) < c->numTarefas) {
+        TarefaConstrucao* tarefa = &c->tarefas[t];
+        *tarefa->destino = construirNoBloco(c->vetor, c->nos, tarefa->inicio, tarefa->fim);
+    }
+    return NULL;
+}
+
+// Função para criar a árvore balanceada com 'numThreads' threads (a principal incluída)
+// A forma é idêntica à de inserirElementos; libere com liberarArvoreParalela
+NoArvore* inserirElementosParalelo(const int vetor[], int n, int numThreads, int grao) {
+    if (n <= 0)
+        return NULL;
+    if (numThreads < 1)
+        numThreads = 1;
+    if (grao < 1)
+        grao = GRAO_CONSTRUCAO;
+
+    ConstrucaoParalela c;
+    c.vetor = vetor;
+    c.nos = (NoArvore*)malloc(sizeof(NoArvore) * (size_t)n);
+    c.capacidade = 64;
+    c.tarefas = (TarefaConstrucao*)malloc(sizeof(TarefaConstrucao) * c.capacidade);
+    if (c.nos == NULL || c.tarefas == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    c.numTarefas = 0;
+    atomic_init(&c.proxima, 0);
+
+    NoArvore* raiz;
+    dividirConstrucao(&c, 0, n - 1, &raiz, grao);
+
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * numThreads);
+    if (threads == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    // A thread principal também esvazia a fila: uma thread que não subiu só deixa a construção mais lenta
+    int iniciadas = 0;
+    for (int i = 1; i < numThreads; i++) {
+        if (pthread_create(&threads[iniciadas], NULL, trabalhadorConstrucao, &c) == 0)
+            iniciadas++;
+    }
+    trabalhadorConstrucao(&c);
+    for (int i = 0; i < iniciadas; i++)
+        pthread_join(threads[i], NULL);
+
+    free(threads);
+    free(c.tarefas);
+    return raiz;
+}
+
+// Função para liberar uma árvore de inserirElementosParalelo
+// O bloco começa no nó de vetor[0], que é o nó mais à esquerda
+void liberarArvoreParalela(NoArvore* raiz) {
+    if (raiz == NULL)
+        return;
+    while (raiz->esquerda != NULL)
+        raiz = raiz->esquerda;
+    free(raiz);
+}
+
+#ifdef BENCHMARK
+// Benchmark das travessias (gcc -O2 -DBENCHMARK arvorebiniterativa.c -lm)
+// Uso: ./bench [n]  (padrão 10^7 nós); imprime CSV com ns por nó e mallocs por travessia
+//      ./bench construcao [n] [grao]  curva de aceleração da construção paralela
+
+// Visitante do benchmark: soma as chaves para que nenhuma visita seja descartada
+void somarNo(NoArvore* no, void* contexto) {
+    *(long long*)contexto += no->dado;
+}
+
+void somarNoCosturado(NoCosturado* no, void* contexto) {
+    *(long long*)contexto += no->dado;
+}
+
+typedef void (*TravessiaSimples)(NoArvore*, Visitante, void*);
+typedef void (*TravessiaPilha)(NoArvore*, PilhaVetor*, Visitante, void*);
+
+void medirTravessia(const char* nome, NoArvore* raiz, int n, TravessiaSimples simples,
+                    TravessiaPilha comPilha, PilhaVetor* pilha) {
+    long long soma = 0;
+    long long alocacoes = bench_alocacoes_totais;
+    uint64_t inicio = benchAgoraNs();
+    if (simples != NULL)
+        simples(raiz, somarNo, &soma);
+    else
+        comPilha(raiz, pilha, somarNo, &soma);
+    uint64_t fim = benchAgoraNs();
+    printf("%s,%d,%.2f,%lld,%lld\n", nome, n, (double)(fim - inicio) / n,
+           bench_alocacoes_totais - alocacoes, soma);
+}
+
+// Libera a árvore de inserirElementos nó a nó
+void liberarArvore(NoArvore* raiz) {
+    if (raiz != NULL) {
+        liberarArvore(raiz->esquerda);
+        liberarArvore(raiz->direita);
+        free(raiz);
+    }
+}
+
+// Mede inserirElementos (um malloc por nó) e a construção paralela com 1, 2, 4, ...
+// threads até o número de núcleos; a aceleração é relativa à versão paralela com 1 thread
+int benchmarkConstrucao(int n, int grao) {
+    int* vetor = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++)
+        vetor[i] = i;
+    int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    printf("variante,threads,n,grao,segundos,aceleracao\n");
+    uint64_t inicio = benchAgoraNs();
+    NoArvore* raiz = inserirElementos(vetor, 0, n - 1);
+    double sequencial = (benchAgoraNs() - inicio) / 1e9;
+    printf("sequencial_malloc,1,%d,0,%.4f,1.00\n", n, sequencial);
+    liberarArvore(raiz);
+
+    double base = 0;
+    for (int threads = 1;; threads = threads * 2 > nucleos && threads < nucleos ? nucleos : threads * 2) {
+        inicio = benchAgoraNs();
+        raiz = inserirElementosParalelo(vetor, n, threads, grao);
+        double segundos = (benchAgoraNs() - inicio) / 1e9;
+        if (threads == 1)
+            base = segundos;
+        printf("paralela_bloco,%d,%d,%d,%.4f,%.2f\n", threads, n, grao, segundos, base / segundos);
+        liberarArvoreParalela(raiz);
+        if (threads >= nucleos)
+            break;
+    }
+    free(vetor);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "construcao") == 0)
+        return benchmarkConstrucao(argc > 2 ? atoi(argv[2]) : 100000000,
+                                   argc > 3 ? atoi(argv[3]) : GRAO_CONSTRUCAO);
+
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int* vetor = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++)
+        vetor[i] = i;
+
+    NoArvore* raiz = inserirElementos(vetor, 0, n - 1);
+    PilhaVetor* pilha = criarPilhaVetor(64);  // Altura de até 2^64 nós balanceados
+
+    printf("variante,n,ns_por_no,mallocs,soma\n");
+    medirTravessia("pre_recursiva", raiz, n, preOrdemRec, NULL, NULL);
+    medirTravessia("pre_pilha_encadeada", raiz, n, preOrdemIt, NULL, NULL);
+    medirTravessia("pre_pilha_vetor", raiz, n, NULL, preOrdemPilha, pilha);
+    medirTravessia("pre_morris", raiz, n, preOrdemMorris, NULL, NULL);
+    medirTravessia("em_recursiva", raiz, n, emOrdemRec, NULL, NULL);
+    medirTravessia("em_pilha_encadeada", raiz, n, emOrdemIt, NULL, NULL);
+    medirTravessia("em_pilha_vetor", raiz, n, NULL, emOrdemPilha, pilha);
+    medirTravessia("em_morris", raiz, n, emOrdemMorris, NULL, NULL);
+    medirTravessia("pos_recursiva", raiz, n, posOrdemRec, NULL, NULL);
+    medirTravessia("pos_pilha_encadeada", raiz, n, posOrdemIt, NULL, NULL);
+    medirTravessia("pos_pilha_vetor", raiz, n, NULL, posOrdemPilha, pilha);
+    medirTravessia("pos_morris", raiz, n, posOrdemMorris, NULL, NULL);
+
+    // Árvore costurada com a mesma forma: varredura pelos fios nos dois sentidos
+    NoCosturado* costurada = inserirElementosCosturados(vetor, 0, n - 1, NULL, NULL);
+    long long soma = 0;
+    long long alocacoes = bench_alocacoes_totais;
+    uint64_t inicio = benchAgoraNs();
+    emOrdemCosturada(costurada, somarNoCosturado, &soma);
+    uint64_t fim = benchAgoraNs();
+    printf("em_costurada,%d,%.2f,%lld,%lld\n", n, (double)(fim - inicio) / n,
+           bench_alocacoes_totais - alocacoes, soma);
+
+    soma = 0;
+    inicio = benchAgoraNs();
+    emOrdemReversaCosturada(costurada, somarNoCosturado, &soma);
+    fim = benchAgoraNs();
+    printf("em_costurada_reversa,%d,%.2f,%lld,%lld\n", n, (double)(fim - inicio) / n,
+           bench_alocacoes_totais - alocacoes, soma);
+
+    liberarPilhaVetor(pilha);
+    free(vetor);
+    return 0;
+}
+#else
 // Função principal para testar o código
 int main() {
     int vetor[] = {1, 2, 3, 4, 5, 6, 7};  // Vetor ordenado de entrada
@@ -239,29 +948,90 @@ int main() {
     
     // Testa as funções de travessia recursiva
     printf("Travessia Pré-Ordem Recursiva: ");
-    preOrdemRec(raiz);
+    preOrdemRec(raiz, imprimirNo, NULL);
     printf("\n");
     
     printf("Travessia Em Ordem Recursiva: ");
-    emOrdemRec(raiz);
+    emOrdemRec(raiz, imprimirNo, NULL);
     printf("\n");
     
     printf("Travessia Pós-Ordem Recursiva: ");
-    posOrdemRec(raiz);
+    posOrdemRec(raiz, imprimirNo, NULL);
     printf("\n");
     
     // Testa as funções de travessia iterativa
     printf("Travessia Pré-Ordem Iterativa: ");
-    preOrdemIt(raiz);
+    preOrdemIt(raiz, imprimirNo, NULL);
     printf("\n");
     
     printf("Travessia Em Ordem Iterativa: ");
-    emOrdemIt(raiz);
+    emOrdemIt(raiz, imprimirNo, NULL);
     printf("\n");
     
     printf("Travessia Pós-Ordem Iterativa: ");
-    posOrdemIt(raiz);
+    posOrdemIt(raiz, imprimirNo, NULL);
+    printf("\n");
+
+    // Testa as travessias sem alocação (a mesma pilha serve para as três)
+    PilhaVetor* pilha = criarPilhaVetor(16);
+
+    printf("Travessia Pré-Ordem Pilha em Vetor: ");
+    preOrdemPilha(raiz, pilha, imprimirNo, NULL);
+    printf("\n");
+
+    printf("Travessia Em Ordem Pilha em Vetor: ");
+    emOrdemPilha(raiz, pilha, imprimirNo, NULL);
+    printf("\n");
+
+    printf("Travessia Pós-Ordem Pilha em Vetor: ");
+    posOrdemPilha(raiz, pilha, imprimirNo, NULL);
+    printf("\n");
+    liberarPilhaVetor(pilha);
+
+    // Testa as travessias de Morris (memória extra O(1))
+    printf("Travessia Pré-Ordem Morris: ");
+    preOrdemMorris(raiz, imprimirNo, NULL);
+    printf("\n");
+
+    printf("Travessia Em Ordem Morris: ");
+    emOrdemMorris(raiz, imprimirNo, NULL);
+    printf("\n");
+
+    printf("Travessia Pós-Ordem Morris: ");
+    posOrdemMorris(raiz, imprimirNo, NULL);
+    printf("\n");
+
+    // Testa a árvore costurada: inserção, exclusão e iteração nos dois sentidos
+    int valores[] = {50, 30, 70, 20, 40, 60, 80, 35, 45, 65};
+    NoCosturado* costurada = NULL;
+    for (int i = 0; i < 10; i++)
+        costurada = inserirCosturado(costurada, valores[i]);
+
+    printf("Árvore Costurada Em Ordem: ");
+    emOrdemCosturada(costurada, imprimirNoCosturado, NULL);
+    printf("\n");
+
+    printf("Árvore Costurada Em Ordem Reversa: ");
+    emOrdemReversaCosturada(costurada, imprimirNoCosturado, NULL);
+    printf("\n");
+
+    costurada = excluirCosturado(costurada, 30);  // Dois filhos
+    costurada = excluirCosturado(costurada, 60);  // Um filho
+    costurada = excluirCosturado(costurada, 80);  // Folha
+    printf("Árvore Costurada após excluir 30, 60 e 80: ");
+    emOrdemCosturada(costurada, imprimirNoCosturado, NULL);
+    printf("\n");
+
+    // Testa a construção paralela (grão pequeno para gerar várias tarefas)
+    int grande[100];
+    for (int i = 0; i < 100; i++)
+        grande[i] = i;
+    NoArvore* paralela = inserirElementosParalelo(grande, 100, 4, 8);
+    printf("Construção Paralela Pré-Ordem: ");
+    preOrdemRec(paralela, imprimirNo, NULL);
     printf("\n");
+    liberarArvoreParalela(paralela);
 
     return 0;  // Finaliza o programa
 }
+#endif
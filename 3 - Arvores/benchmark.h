@@ -0,0 +1,400 @@
+// Driver de benchmark comum às estruturas da pasta "3 - Arvores"
+//
+// Cada estrutura inclui este arquivo quando compilada com -DBENCHMARK e troca o
+// seu main() por uma chamada a executarBenchmark() com um adaptador. Todas usam
+// os mesmos geradores de carga, as mesmas medições e o mesmo formato de saída.
+//
+// Uso: ./bench [--n N] [--ops M] [--dist seq|unif|zipf] [--leitura R]
+//              [--formato csv|json] [--cabecalho] [--semente S]
+//
+// Fases medidas:
+//   carga   - insere N chaves na ordem da distribuição
+//   mistura - M operações; fração R são buscas (chaves escolhidas pela
+//             distribuição), o restante metade inserções de chaves novas e
+//             metade remoções (quando a estrutura suporta remoção)
+//   salvar / carregar - só para estruturas com snapshot (snapshot.h): grava a
+//             estrutura, tira o arquivo do cache de páginas e carrega de novo;
+//             ops_s é chaves/s, bytes_por_chave é o tamanho do arquivo (salvar)
+//             ou a memória da estrutura carregada (carregar)
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// Programas que usam só parte do driver (por exemplo, apenas os temporizadores)
+// não devem gerar avisos de função não usada
+#define BENCH_API static __attribute__((unused))
+
+// ---------------------------------------------------------------------------
+// Contagem de memória: malloc/free das estruturas passam por aqui
+// ---------------------------------------------------------------------------
+
+static long long bench_bytes_vivos = 0;   // Bytes pedidos e ainda não liberados
+static long long bench_alocacoes_vivas = 0;
+static long long bench_alocacoes_totais = 0;  // Chamadas a malloc desde o início
+
+// Cada bloco guarda o tamanho pedido em um prefixo de 16 bytes (mantém o alinhamento)
+static inline void *benchMalloc(size_t tamanho) {
+    size_t *bloco = (size_t *)malloc(tamanho + 16);
+    if (bloco == NULL)
+        return NULL;
+    bloco[0] = tamanho;
+    bench_bytes_vivos += tamanho;
+    bench_alocacoes_vivas++;
+    bench_alocacoes_totais++;
+    return (char *)bloco + 16;
+}
+
+static inline void benchFree(void *ptr) {
+    if (ptr == NULL)
+        return;
+    size_t *bloco = (size_t *)((char *)ptr - 16);
+    bench_bytes_vivos -= bloco[0];
+    bench_alocacoes_vivas--;
+    free(bloco);
+}
+
+static inline void *benchCalloc(size_t quantidade, size_t tamanho) {
+    void *ptr = benchMalloc(quantidade * tamanho);
+    if (ptr != NULL)
+        memset(ptr, 0, quantidade * tamanho);
+    return ptr;
+}
+
+static inline void *benchRealloc(void *ptr, size_t tamanho) {
+    if (ptr == NULL)
+        return benchMalloc(tamanho);
+    size_t antigo = ((size_t *)((char *)ptr - 16))[0];
+    void *novo = benchMalloc(tamanho);
+    if (novo != NULL) {
+        memcpy(novo, ptr, antigo < tamanho ? antigo : tamanho);
+        benchFree(ptr);
+    }
+    return novo;
+}
+
+// ---------------------------------------------------------------------------
+// Adaptador: como o driver conversa com cada estrutura
+// ---------------------------------------------------------------------------
+
+typedef struct AdaptadorBench {
+    const char *nome;
+    void *(*criar)(void);
+    void (*inserir)(void *estrutura, int chave);
+    int (*buscar)(void *estrutura, int chave);        // Retorna 1 se encontrou
+    void (*remover)(void *estrutura, int chave);      // NULL se não há remoção
+    int (*altura)(void *estrutura);                   // Níveis da estrutura
+    long long (*salvar)(void *estrutura, const char *caminho);  // Opcional: snapshot; retorna as chaves gravadas
+    void *(*carregar)(const char *caminho);                     // Opcional: snapshot
+} AdaptadorBench;
+
+// ---------------------------------------------------------------------------
+// Geradores de carga
+// ---------------------------------------------------------------------------
+
+#define BENCH_SEQUENCIAL 0
+#define BENCH_UNIFORME 1
+#define BENCH_ZIPF 2
+
+#define BENCH_MAX_AMOSTRAS 1000000  // Latências guardadas por fase
+
+static uint64_t bench_estado = 88172645463325252ULL;
+
+BENCH_API uint64_t benchAleatorio(void) {  // xorshift64
+    bench_estado ^= bench_estado << 13;
+    bench_estado ^= bench_estado >> 7;
+    bench_estado ^= bench_estado << 17;
+    return bench_estado;
+}
+
+BENCH_API double benchAleatorio01(void) {
+    return (benchAleatorio() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Chave do i-ésimo elemento: sequencial usa o próprio índice, as demais
+// espalham o índice por uma bijeção em 31 bits (sem chaves repetidas)
+BENCH_API int benchChave(int distribuicao, long long i) {
+    if (distribuicao == BENCH_SEQUENCIAL)
+        return (int)i;
+    return (int)(((uint64_t)i * 2654435761ULL + 0x5bd1e995ULL) & 0x7fffffff);
+}
+
+// Gerador Zipf (Gray et al., "Quickly Generating Billion-Record Synthetic Databases")
+typedef struct BenchZipf {
+    long long n;
+    double theta, alfa, zetan, eta;
+} BenchZipf;
+
+BENCH_API void benchIniciarZipf(BenchZipf *z, long long n, double theta) {
+    double zeta2 = 1.0 + pow(0.5, theta);
+    z->n = n;
+    z->theta = theta;
+    z->alfa = 1.0 / (1.0 - theta);
+    z->zetan = 0;
+    for (long long i = 1; i <= n; i++)
+        z->zetan += 1.0 / pow((double)i, theta);
+    z->eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / z->zetan);
+}
+
+BENCH_API long long benchProximoZipf(BenchZipf *z) {
+    double u = benchAleatorio01();
+    double uz = u * z->zetan;
+    if (uz < 1.0)
+        return 0;
+    if (uz < 1.0 + pow(0.5, z->theta))
+        return 1;
+    long long r = (long long)(z->n * pow(z->eta * u - z->eta + 1.0, z->alfa));
+    return r < z->n ? r : z->n - 1;
+}
+
+// ---------------------------------------------------------------------------
+// Medição
+// ---------------------------------------------------------------------------
+
+static inline uint64_t benchAgoraNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+BENCH_API int benchCompararU32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+typedef struct BenchResultado {
+    const char *fase;
+    long long operacoes;
+    double ops_por_segundo;
+    uint32_t p50_ns, p99_ns;
+    double bytes_por_chave;
+    int altura;
+} BenchResultado;
+
+// Amostragem de latências: mede uma operação a cada 'passo'
+typedef struct BenchAmostras {
+    uint32_t *valores;
+    long long n, passo;
+} BenchAmostras;
+
+BENCH_API void benchIniciarAmostras(BenchAmostras *a, long long operacoes) {
+    a->passo = operacoes / BENCH_MAX_AMOSTRAS + 1;
+    a->n = 0;
+    a->valores = (uint32_t *)malloc(sizeof(uint32_t) * (operacoes / a->passo + 1));
+}
+
+BENCH_API void benchPercentis(BenchAmostras *a, BenchResultado *r) {
+    r->p50_ns = r->p99_ns = 0;
+    if (a->n > 0) {
+        qsort(a->valores, a->n, sizeof(uint32_t), benchCompararU32);
+        r->p50_ns = a->valores[a->n / 2];
+        r->p99_ns = a->valores[(a->n * 99) / 100];
+    }
+    free(a->valores);
+}
+
+BENCH_API const char *benchNomeDistribuicao(int distribuicao) {
+    if (distribuicao == BENCH_SEQUENCIAL)
+        return "seq";
+    return distribuicao == BENCH_UNIFORME ? "unif" : "zipf";
+}
+
+BENCH_API void benchImprimir(const AdaptadorBench *adaptador, int distribuicao, long long n,
+                          double leitura, int json, const BenchResultado *r) {
+    if (json) {
+        printf("{\"estrutura\":\"%s\",\"distribuicao\":\"%s\",\"n\":%lld,\"leitura\":%.2f,"
+               "\"fase\":\"%s\",\"operacoes\":%lld,\"ops_s\":%.0f,\"p50_ns\":%u,\"p99_ns\":%u,"
+               "\"bytes_por_chave\":%.1f,\"altura\":%d}\n",
+               adaptador->nome, benchNomeDistribuicao(distribuicao), n, leitura, r->fase,
+               r->operacoes, r->ops_por_segundo, r->p50_ns, r->p99_ns, r->bytes_por_chave, r->altura);
+    } else {
+        printf("%s,%s,%lld,%.2f,%s,%lld,%.0f,%u,%u,%.1f,%d\n",
+               adaptador->nome, benchNomeDistribuicao(distribuicao), n, leitura, r->fase,
+               r->operacoes, r->ops_por_segundo, r->p50_ns, r->p99_ns, r->bytes_por_chave, r->altura);
+    }
+    fflush(stdout);
+}
+
+// ---------------------------------------------------------------------------
+// Driver
+// ---------------------------------------------------------------------------
+
+BENCH_API int executarBenchmark(const AdaptadorBench *adaptador, int argc, char *argv[]) {
+    long long n = 1000000, operacoes = -1;
+    int distribuicao = BENCH_UNIFORME, json = 0, cabecalho = 0;
+    double leitura = 0.9;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--n") && i + 1 < argc)
+            n = atoll(argv[++i]);
+        else if (!strcmp(argv[i], "--ops") && i + 1 < argc)
+            operacoes = atoll(argv[++i]);
+        else if (!strcmp(argv[i], "--leitura") && i + 1 < argc)
+            leitura = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--semente") && i + 1 < argc)
+            bench_estado = strtoull(argv[++i], NULL, 10) | 1;
+        else if (!strcmp(argv[i], "--formato") && i + 1 < argc)
+            json = !strcmp(argv[++i], "json");
+        else if (!strcmp(argv[i], "--cabecalho"))
+            cabecalho = 1;
+        else if (!strcmp(argv[i], "--dist") && i + 1 < argc) {
+            i++;
+            distribuicao = !strcmp(argv[i], "seq") ? BENCH_SEQUENCIAL
+                         : !strcmp(argv[i], "zipf") ? BENCH_ZIPF : BENCH_UNIFORME;
+        } else {
+            fprintf(stderr, "Uso: %s [--n N] [--ops M] [--dist seq|unif|zipf] [--leitura R] "
+                            "[--formato csv|json] [--cabecalho] [--semente S]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (n < 1 || n > 0x7fffffffLL) {
+        fprintf(stderr, "Erro: --n precisa estar entre 1 e 2^31-1.\n");
+        return 1;
+    }
+    if (operacoes < 0)
+        operacoes = n;
+
+    if (cabecalho && !json)
+        printf("estrutura,distribuicao,n,leitura,fase,operacoes,ops_s,p50_ns,p99_ns,bytes_por_chave,altura\n");
+
+    void *estrutura = adaptador->criar();
+    BenchAmostras amostras;
+    BenchResultado r;
+    long long base_bytes = bench_bytes_vivos;
+
+    // Fase de carga
+    benchIniciarAmostras(&amostras, n);
+    uint64_t inicio = benchAgoraNs();
+    for (long long i = 0; i < n; i++) {
+        int chave = benchChave(distribuicao, i);
+        if (i % amostras.passo == 0) {
+            uint64_t t0 = benchAgoraNs();
+            adaptador->inserir(estrutura, chave);
+            amostras.valores[amostras.n++] = (uint32_t)(benchAgoraNs() - t0);
+        } else {
+            adaptador->inserir(estrutura, chave);
+        }
+    }
+    uint64_t fim = benchAgoraNs();
+
+    r.fase = "carga";
+    r.operacoes = n;
+    r.ops_por_segundo = n / ((fim - inicio) / 1e9);
+    r.bytes_por_chave = (double)(bench_bytes_vivos - base_bytes) / n;
+    r.altura = adaptador->altura(estrutura);
+    benchPercentis(&amostras, &r);
+    benchImprimir(adaptador, distribuicao, n, leitura, json, &r);
+
+    // Fase de mistura leitura/escrita
+    BenchZipf zipf;
+    if (distribuicao == BENCH_ZIPF)
+        benchIniciarZipf(&zipf, n, 0.99);
+
+    long long proxima_nova = n;
+    long long encontrados = 0;
+    long long chaves = n;  // Estimativa de chaves presentes (remoções podem errar o alvo)
+    benchIniciarAmostras(&amostras, operacoes);
+    inicio = benchAgoraNs();
+    for (long long i = 0; i < operacoes; i++) {
+        double sorteio = benchAleatorio01();
+        long long indice;
+
+        // Índice do elemento alvo conforme a distribuição
+        if (distribuicao == BENCH_SEQUENCIAL)
+            indice = i % n;
+        else if (distribuicao == BENCH_ZIPF)
+            indice = benchProximoZipf(&zipf);
+        else
+            indice = (long long)(benchAleatorio() % (uint64_t)n);
+
+        int amostrar = (i % amostras.passo == 0);
+        uint64_t t0 = amostrar ? benchAgoraNs() : 0;
+
+        if (sorteio < leitura) {
+            encontrados += adaptador->buscar(estrutura, benchChave(distribuicao, indice));
+        } else if (adaptador->remover != NULL && sorteio < leitura + (1.0 - leitura) / 2) {
+            adaptador->remover(estrutura, benchChave(distribuicao, indice));
+            chaves--;
+        } else {
+            adaptador->inserir(estrutura, benchChave(distribuicao, proxima_nova++));
+            chaves++;
+        }
+
+        if (amostrar)
+            amostras.valores[amostras.n++] = (uint32_t)(benchAgoraNs() - t0);
+    }
+    fim = benchAgoraNs();
+
+    r.fase = "mistura";
+    r.operacoes = operacoes;
+    r.ops_por_segundo = operacoes / ((fim - inicio) / 1e9);
+    r.bytes_por_chave = chaves > 0 ? (double)(bench_bytes_vivos - base_bytes) / chaves : 0;
+    r.altura = adaptador->altura(estrutura);
+    benchPercentis(&amostras, &r);
+    benchImprimir(adaptador, distribuicao, n, leitura, json, &r);
+
+    // Fases de snapshot
+    if (adaptador->salvar != NULL && adaptador->carregar != NULL) {
+        const char *caminho = "snapshot_benchmark.bin";
+        struct stat info;
+
+        inicio = benchAgoraNs();
+        long long chaves_arquivo = adaptador->salvar(estrutura, caminho);
+        if (chaves_arquivo < 0 || stat(caminho, &info) != 0) {
+            fprintf(stderr, "Erro: Falha ao salvar o snapshot.\n");
+            return 1;
+        }
+        fim = benchAgoraNs();
+
+        r.fase = "salvar";
+        r.operacoes = chaves_arquivo;
+        r.ops_por_segundo = chaves_arquivo / ((fim - inicio) / 1e9);
+        r.p50_ns = r.p99_ns = 0;
+        r.bytes_por_chave = chaves_arquivo > 0 ? (double)info.st_size / chaves_arquivo : 0;
+        r.altura = adaptador->altura(estrutura);
+        benchImprimir(adaptador, distribuicao, n, leitura, json, &r);
+
+        // Tira o arquivo do cache de páginas para medir uma partida a frio
+        int fd = open(caminho, O_RDONLY);
+        if (fd >= 0) {
+            fsync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+
+        long long antes = bench_bytes_vivos;
+        inicio = benchAgoraNs();
+        void *carregada = adaptador->carregar(caminho);
+        fim = benchAgoraNs();
+
+        r.fase = "carregar";
+        r.ops_por_segundo = chaves_arquivo / ((fim - inicio) / 1e9);
+        r.bytes_por_chave = chaves_arquivo > 0 ? (double)(bench_bytes_vivos - antes) / chaves_arquivo : 0;
+        r.altura = carregada != NULL ? adaptador->altura(carregada) : -1;
+        benchImprimir(adaptador, distribuicao, n, leitura, json, &r);
+        remove(caminho);
+    }
+
+    // Evita que o compilador descarte as buscas
+    if (encontrados < 0)
+        printf("%lld\n", encontrados);
+    return 0;
+}
+
+// A partir daqui (código da estrutura) toda alocação é contabilizada;
+// as alocações do próprio driver acima não entram na conta
+#define malloc(tamanho) benchMalloc(tamanho)
+#define free(ptr) benchFree(ptr)
+#define calloc(quantidade, tamanho) benchCalloc(quantidade, tamanho)
+#define realloc(ptr, tamanho) benchRealloc(ptr, tamanho)
+
+#endif
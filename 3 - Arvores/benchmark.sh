@@ -0,0 +1,54 @@
+#!/bin/sh
+# Compila cada estrutura com -DBENCHMARK e roda a grade de cargas, emitindo um
+# único CSV (ou JSON Lines com FORMATO=json) na saída padrão.
+#
+# Variáveis de ambiente (valores padrão entre parênteses):
+#   TAMANHOS       chaves carregadas          ("1000 100000 1000000")
+#   DISTRIBUICOES  seq, unif e/ou zipf        ("seq unif zipf")
+#   LEITURAS       fração de buscas na mistura ("0.5 0.9 0.99")
+#   ESTRUTURAS     arquivos .c a medir; "arquivo:--opcao" passa uma opção de modo
+#                  ("BinaryTree BinaryTree:--bode-expiatorio AVL RedBlack treap ArvoreB HeapMax HeapMax:--dario HeapPareamento")
+#   FORMATO        csv ou json                (csv)
+#   LIMITE_SEQ_BST maior N sequencial para a BST sem balanceamento (20000):
+#                  acima disso ela vira uma lista, leva O(n^2) e estoura a pilha
+#
+# Exemplo: TAMANHOS="1000000 10000000" ./benchmark.sh > resultados.csv
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+TAMANHOS=${TAMANHOS:-"1000 100000 1000000"}
+DISTRIBUICOES=${DISTRIBUICOES:-"seq unif zipf"}
+LEITURAS=${LEITURAS:-"0.5 0.9 0.99"}
+ESTRUTURAS=${ESTRUTURAS:-"BinaryTree BinaryTree:--bode-expiatorio AVL RedBlack treap ArvoreB HeapMax HeapMax:--dario HeapPareamento"}
+FORMATO=${FORMATO:-csv}
+LIMITE_SEQ_BST=${LIMITE_SEQ_BST:-20000}
+CC=${CC:-gcc}
+
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+for estrutura in $ESTRUTURAS; do
+    arquivo=${estrutura%%:*}
+    [ -x "$BUILD/$arquivo" ] || "$CC" -O2 -DBENCHMARK "$DIR/$arquivo.c" -o "$BUILD/$arquivo" -lm -pthread || exit 1
+done
+
+cabecalho=--cabecalho
+for estrutura in $ESTRUTURAS; do
+    arquivo=${estrutura%%:*}
+    opcao=
+    [ "$arquivo" != "$estrutura" ] && opcao=${estrutura#*:}
+    for n in $TAMANHOS; do
+        for dist in $DISTRIBUICOES; do
+            if [ "$estrutura" = BinaryTree ] && [ "$dist" = seq ] && [ "$n" -gt "$LIMITE_SEQ_BST" ]; then
+                echo "# pulando $estrutura seq n=$n (acima de LIMITE_SEQ_BST)" >&2
+                continue
+            fi
+            for leitura in $LEITURAS; do
+                if ! "$BUILD/$arquivo" $opcao --n "$n" --dist "$dist" --leitura "$leitura" \
+                        --formato "$FORMATO" $cabecalho; then
+                    echo "# falha: $estrutura n=$n dist=$dist leitura=$leitura" >&2
+                fi
+                cabecalho=
+            done
+        done
+    done
+done
@@ -0,0 +1,325 @@
+// Formato binário de snapshot para salvar e carregar árvores em tempo linear
+//
+// Layout do arquivo (inteiros na ordem de bytes da máquina):
+//   cabeçalho  16 bytes: assinatura "ARVS", versão (u16), tipo de árvore (u16), n (u64)
+//   chaves     n x int32 em pré-ordem
+//   metas      n x uint8 em pré-ordem:
+//                bit 0 = tem filho esquerdo, bit 1 = tem filho direito,
+//                bits 2..7 = dado auxiliar da árvore (altura AVL, cor Red-Black)
+//
+// A pré-ordem com os dois bits de estrutura determina a forma exata da árvore,
+// então a carga religa os nós sem nenhuma comparação de chaves. A gravação
+// percorre a árvore uma vez, descarrega as chaves em blocos de 4 MB e grava as
+// metas e o cabeçalho no final; a leitura mapeia o arquivo com mmap e lê as
+// duas seções sequencialmente.
+//
+// O percurso e a religação (salvarSnapshot e carregarSnapshot) servem a todas
+// as árvores; cada uma só fornece um AcessoSnapshot que lê e monta os seus nós.
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SNAPSHOT_ASSINATURA 0x53565241u  // "ARVS"
+#define SNAPSHOT_VERSAO 1
+#define SNAPSHOT_BUFFER (1 << 20)        // Chaves por descarga (4 MB)
+
+#define SNAPSHOT_BST 1
+#define SNAPSHOT_AVL 2
+#define SNAPSHOT_REDBLACK 3
+
+#define SNAPSHOT_TEM_ESQUERDA 1
+#define SNAPSHOT_TEM_DIREITA 2
+#define SNAPSHOT_AUX(meta) ((meta) >> 2)
+#define SNAPSHOT_BYTES_POR_NO (sizeof(int32_t) + 1)  // Chave e meta
+
+typedef struct CabecalhoSnapshot {
+    uint32_t assinatura;
+    uint16_t versao;
+    uint16_t tipo;
+    uint64_t n;
+} CabecalhoSnapshot;
+
+typedef struct EscritorSnapshot {
+    int fd;
+    uint64_t n;           // Nós gravados até agora
+    size_t usados;        // Chaves no buffer atual
+    int32_t *chaves;      // Buffer de chaves (descarregado a cada SNAPSHOT_BUFFER)
+    uint8_t *metas;       // Metas de todos os nós (1 byte por nó, gravadas no final)
+    uint64_t cap_metas;
+} EscritorSnapshot;
+
+typedef struct LeitorSnapshot {
+    void *mapa;
+    size_t tamanho;
+    uint64_t n;
+    const int32_t *chaves;
+    const uint8_t *metas;
+} LeitorSnapshot;
+
+// Como o percurso genérico lê e monta os nós de uma árvore
+typedef struct AcessoSnapshot {
+    int tipo;  // SNAPSHOT_BST, SNAPSHOT_AVL ou SNAPSHOT_REDBLACK
+    void *(*esquerda)(const void *no);
+    void *(*direita)(const void *no);
+    int32_t (*chave)(const void *no);
+    uint8_t (*auxiliar)(const void *no);              // Dado auxiliar (0 a 63); NULL se não há
+    void *(*criar)(int32_t chave, uint8_t auxiliar);  // Nó novo, ainda sem filhos
+    void (*ligar)(void *pai, void *filho, int direita);
+    void (*liberar)(void *no);  // Libera um nó criado por 'criar'
+} AcessoSnapshot;
+
+// Função para (re)alocar memória, encerrando o programa se faltar
+static void *alocarSnapshot(void *ptr, size_t tamanho) {
+    ptr = realloc(ptr, tamanho);
+    if (ptr == NULL) {
+        printf("Erro: Falha na alocação de memória.\n");
+        exit(-1);
+    }
+    return ptr;
+}
+
+// Função para gravar um bloco inteiro (write pode gravar menos do que o pedido)
+static int gravarTudo(int fd, const void *dados, size_t tamanho) {
+    const char *p = (const char *)dados;
+    while (tamanho > 0) {
+        ssize_t gravado = write(fd, p, tamanho);
+        if (gravado <= 0)
+            return -1;
+        p += gravado;
+        tamanho -= (size_t)gravado;
+    }
+    return 0;
+}
+
+// Função para criar o arquivo; o cabeçalho é gravado ao fechar, quando n é conhecido
+// Assim a árvore é percorrida uma única vez
+static int abrirEscritaSnapshot(EscritorSnapshot *e, const char *caminho) {
+    CabecalhoSnapshot vazio;
+
+    e->fd = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (e->fd < 0)
+        return -1;
+
+    memset(&vazio, 0, sizeof(vazio));
+    if (gravarTudo(e->fd, &vazio, sizeof(vazio)) != 0) {
+        close(e->fd);
+        return -1;
+    }
+
+    e->n = 0;
+    e->usados = 0;
+    e->cap_metas = SNAPSHOT_BUFFER;
+    e->chaves = (int32_t *)alocarSnapshot(NULL, SNAPSHOT_BUFFER * sizeof(int32_t));
+    e->metas = (uint8_t *)alocarSnapshot(NULL, e->cap_metas);
+    return 0;
+}
+
+// Função para acrescentar um nó (em pré-ordem)
+static inline int gravarNoSnapshot(EscritorSnapshot *e, int32_t chave, uint8_t meta) {
+    if (e->n == e->cap_metas) {
+        e->cap_metas *= 2;
+        e->metas = (uint8_t *)alocarSnapshot(e->metas, e->cap_metas);
+    }
+    e->metas[e->n++] = meta;
+    e->chaves[e->usados++] = chave;
+    if (e->usados == SNAPSHOT_BUFFER) {
+        e->usados = 0;
+        return gravarTudo(e->fd, e->chaves, SNAPSHOT_BUFFER * sizeof(int32_t));
+    }
+    return 0;
+}
+
+// Função para gravar as chaves restantes, as metas e o cabeçalho e fechar o arquivo
+static int fecharEscritaSnapshot(EscritorSnapshot *e, int tipo) {
+    CabecalhoSnapshot cab;
+    int resultado = 0;
+
+    cab.assinatura = SNAPSHOT_ASSINATURA;
+    cab.versao = SNAPSHOT_VERSAO;
+    cab.tipo = (uint16_t)tipo;
+    cab.n = e->n;
+
+    if (gravarTudo(e->fd, e->chaves, e->usados * sizeof(int32_t)) != 0 ||
+        gravarTudo(e->fd, e->metas, e->n) != 0 ||
+        pwrite(e->fd, &cab, sizeof(cab), 0) != sizeof(cab))
+        resultado = -1;
+
+    free(e->chaves);
+    free(e->metas);
+    if (close(e->fd) != 0)
+        resultado = -1;
+    return resultado;
+}
+
+// Função para mapear um snapshot e validar cabeçalho, tipo e tamanho
+static int abrirLeituraSnapshot(LeitorSnapshot *l, const char *caminho, int tipo) {
+    struct stat info;
+    int fd = open(caminho, O_RDONLY);
+
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(CabecalhoSnapshot)) {
+        close(fd);
+        return -1;
+    }
+
+    l->tamanho = (size_t)info.st_size;
+    l->mapa = mmap(NULL, l->tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (l->mapa == MAP_FAILED)
+        return -1;
+    madvise(l->mapa, l->tamanho, MADV_SEQUENTIAL);
+
+    const CabecalhoSnapshot *cab = (const CabecalhoSnapshot *)l->mapa;
+    // n vem do arquivo: é limitado pelo tamanho antes de entrar na conta, que poderia estourar
+    if (cab->assinatura != SNAPSHOT_ASSINATURA || cab->versao != SNAPSHOT_VERSAO || cab->tipo != tipo ||
+        cab->n > (l->tamanho - sizeof(CabecalhoSnapshot)) / SNAPSHOT_BYTES_POR_NO ||
+        l->tamanho != sizeof(CabecalhoSnapshot) + cab->n * SNAPSHOT_BYTES_POR_NO) {
+        munmap(l->mapa, l->tamanho);
+        return -1;
+    }
+
+    l->n = cab->n;
+    l->chaves = (const int32_t *)((const char *)l->mapa + sizeof(CabecalhoSnapshot));
+    l->metas = (const uint8_t *)(l->chaves + l->n);
+    return 0;
+}
+
+static void fecharLeituraSnapshot(LeitorSnapshot *l) {
+    munmap(l->mapa, l->tamanho);
+}
+
+// Função para salvar uma árvore; retorna o número de nós gravados ou -1
+// Percorre em pré-ordem com uma pilha explícita, sem recursão
+static long long salvarSnapshot(const void *raiz, const char *caminho, const AcessoSnapshot *acesso) {
+    EscritorSnapshot escritor;
+    long capacidade = 1024, topo = 0;
+    int resultado = 0;
+
+    if (abrirEscritaSnapshot(&escritor, caminho) != 0)
+        return -1;
+
+    const void **pilha = (const void **)alocarSnapshot(NULL, sizeof(void *) * capacidade);
+    if (raiz != NULL)
+        pilha[topo++] = raiz;
+
+    while (topo > 0 && resultado == 0) {
+        const void *atual = pilha[--topo];
+        void *esquerda = acesso->esquerda(atual), *direita = acesso->direita(atual);
+        uint8_t meta = (esquerda != NULL ? SNAPSHOT_TEM_ESQUERDA : 0) | (direita != NULL ? SNAPSHOT_TEM_DIREITA : 0);
+        if (acesso->auxiliar != NULL)
+            meta |= (uint8_t)(acesso->auxiliar(atual) << 2);
+        resultado = gravarNoSnapshot(&escritor, acesso->chave(atual), meta);
+
+        if (topo + 2 > capacidade) {
+            capacidade *= 2;
+            pilha = (const void **)alocarSnapshot(pilha, sizeof(void *) * capacidade);
+        }
+        // Direita primeiro para que a esquerda saia antes da pilha
+        if (direita != NULL)
+            pilha[topo++] = direita;
+        if (esquerda != NULL)
+            pilha[topo++] = esquerda;
+    }
+
+    free(pilha);
+    long long nos = (long long)escritor.n;
+    if (fecharEscritaSnapshot(&escritor, acesso->tipo) != 0)
+        resultado = -1;
+    return resultado == 0 ? nos : -1;
+}
+
+// Função para liberar os nós já montados de uma árvore incompleta
+static void descartarSnapshot(void *raiz, const AcessoSnapshot *acesso) {
+    long capacidade = 1024, topo = 0;
+    void **pilha = (void **)alocarSnapshot(NULL, sizeof(void *) * capacidade);
+
+    if (raiz != NULL)
+        pilha[topo++] = raiz;
+    while (topo > 0) {
+        void *atual = pilha[--topo];
+        if (topo + 2 > capacidade) {
+            capacidade *= 2;
+            pilha = (void **)alocarSnapshot(pilha, sizeof(void *) * capacidade);
+        }
+        if (acesso->esquerda(atual) != NULL)
+            pilha[topo++] = acesso->esquerda(atual);
+        if (acesso->direita(atual) != NULL)
+            pilha[topo++] = acesso->direita(atual);
+        acesso->liberar(atual);
+    }
+    free(pilha);
+}
+
+// Função para carregar uma árvore salva por salvarSnapshot; retorna NULL se o
+// arquivo for inválido ou se a estrutura gravada não fechar
+// Religa os nós na ordem do arquivo em O(n), sem nenhuma comparação de chaves:
+// o nó seguinte é o filho esquerdo do anterior, ou o filho direito do último
+// nó que ainda espera um filho direito
+static void *carregarSnapshot(const char *caminho, const AcessoSnapshot *acesso) {
+    LeitorSnapshot leitor;
+    long capacidade = 1024, topo = 0;
+    void *raiz = NULL, *anterior = NULL;
+    int corrompido = 0;
+
+    if (abrirLeituraSnapshot(&leitor, caminho, acesso->tipo) != 0) {
+        printf("Erro: Snapshot inválido ou inexistente: %s\n", caminho);
+        return NULL;
+    }
+
+    // Nós que ainda esperam o filho direito
+    void **pilha = (void **)alocarSnapshot(NULL, sizeof(void *) * capacidade);
+
+    for (uint64_t i = 0; i < leitor.n; i++) {
+        void *pai = NULL;
+        int direita = 0;
+        if (i > 0 && (leitor.metas[i - 1] & SNAPSHOT_TEM_ESQUERDA))
+            pai = anterior;
+        else if (i > 0 && topo > 0) {
+            pai = pilha[--topo];
+            direita = 1;
+        } else if (i > 0) {
+            corrompido = 1;  // Sobrou um nó sem lugar na árvore
+            break;
+        }
+
+        void *novoNo = acesso->criar(leitor.chaves[i], SNAPSHOT_AUX(leitor.metas[i]));
+        if (pai == NULL)
+            raiz = novoNo;
+        else
+            acesso->ligar(pai, novoNo, direita);
+
+        if (leitor.metas[i] & SNAPSHOT_TEM_DIREITA) {
+            if (topo == capacidade) {
+                capacidade *= 2;
+                pilha = (void **)alocarSnapshot(pilha, sizeof(void *) * capacidade);
+            }
+            pilha[topo++] = novoNo;
+        }
+        anterior = novoNo;
+    }
+
+    // Arquivo cortado: ainda há nós esperando um filho direito ou o último espera o esquerdo
+    if (topo != 0 || (leitor.n > 0 && (leitor.metas[leitor.n - 1] & SNAPSHOT_TEM_ESQUERDA)))
+        corrompido = 1;
+
+    free(pilha);
+    fecharLeituraSnapshot(&leitor);
+    if (corrompido) {
+        printf("Erro: Snapshot corrompido: %s\n", caminho);
+        descartarSnapshot(raiz, acesso);
+        return NULL;
+    }
+    return raiz;
+}
+
+#endif
@@ -1,6 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#ifdef BENCHMARK
+#include "benchmark.h"  // Contabiliza malloc/free e fornece o driver de benchmark
+#endif
 
 // Estrutura do nó da Treap
 typedef struct No {
@@ -135,6 +138,44 @@ void percorrerEmOrdem(No* raiz) {
 }
 
 // Função principal para teste
+#ifdef BENCHMARK
+// Adaptador para o driver de benchmark (gcc -O2 -DBENCHMARK treap.c -lm)
+void* benchCriar(void) {
+    return calloc(1, sizeof(No*));
+}
+
+void benchInserir(void* estrutura, int chave) {
+    No** raiz = (No**)estrutura;
+    *raiz = inserir(*raiz, chave);
+}
+
+int benchBuscar(void* estrutura, int chave) {
+    return buscar(*(No**)estrutura, chave) != NULL;
+}
+
+void benchRemover(void* estrutura, int chave) {
+    No** raiz = (No**)estrutura;
+    *raiz = remover(*raiz, chave);
+}
+
+int benchNiveis(No* raiz) {
+    if (raiz == NULL)
+        return 0;
+    int esq = benchNiveis(raiz->esq);
+    int dir = benchNiveis(raiz->dir);
+    return 1 + (esq > dir ? esq : dir);
+}
+
+int benchAltura(void* estrutura) {
+    return benchNiveis(*(No**)estrutura);
+}
+
+int main(int argc, char* argv[]) {
+    AdaptadorBench adaptador = {.nome = "treap", .criar = benchCriar, .inserir = benchInserir,
+                                .buscar = benchBuscar, .remover = benchRemover, .altura = benchAltura};
+    return executarBenchmark(&adaptador, argc, argv);
+}
+#else
 int main() {
     srand(time(NULL));  // Inicializa gerador de números aleatórios
     No* raiz = NULL;
@@ -157,4 +198,5 @@ int main() {
     percorrerEmOrdem(raiz);
 
     return 0;
-}
\ No newline at end of file
+}
+#endif